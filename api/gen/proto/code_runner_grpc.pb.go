@@ -19,7 +19,9 @@ import (
 const _ = grpc.SupportPackageIsVersion9
 
 const (
-	SolutionEvaluationService_EvaluateSolution_FullMethodName = "/com.levelupjourney.coderunner.SolutionEvaluationService/EvaluateSolution"
+	SolutionEvaluationService_EvaluateSolution_FullMethodName       = "/com.levelupjourney.coderunner.SolutionEvaluationService/EvaluateSolution"
+	SolutionEvaluationService_EvaluateSolutionsBatch_FullMethodName = "/com.levelupjourney.coderunner.SolutionEvaluationService/EvaluateSolutionsBatch"
+	SolutionEvaluationService_EvaluateSolutionStream_FullMethodName = "/com.levelupjourney.coderunner.SolutionEvaluationService/EvaluateSolutionStream"
 )
 
 // SolutionEvaluationServiceClient is the client API for SolutionEvaluationService service.
@@ -30,6 +32,12 @@ const (
 type SolutionEvaluationServiceClient interface {
 	// Execute solution code and return approved test IDs
 	EvaluateSolution(ctx context.Context, in *ExecutionRequest, opts ...grpc.CallOption) (*ExecutionResponse, error)
+	// Evaluate many submissions at once (e.g. regrading a cohort); identical code is
+	// executed only once and results are streamed back as they complete
+	EvaluateSolutionsBatch(ctx context.Context, in *BatchExecutionRequest, opts ...grpc.CallOption) (grpc.ServerStreamingClient[BatchExecutionResult], error)
+	// Same as EvaluateSolution, but streams progress events (queued, compiling, compiled,
+	// running, one per test as it finishes) and ends with a done event carrying the response
+	EvaluateSolutionStream(ctx context.Context, in *ExecutionRequest, opts ...grpc.CallOption) (grpc.ServerStreamingClient[ExecutionProgress], error)
 }
 
 type solutionEvaluationServiceClient struct {
@@ -50,6 +58,44 @@ func (c *solutionEvaluationServiceClient) EvaluateSolution(ctx context.Context,
 	return out, nil
 }
 
+func (c *solutionEvaluationServiceClient) EvaluateSolutionsBatch(ctx context.Context, in *BatchExecutionRequest, opts ...grpc.CallOption) (grpc.ServerStreamingClient[BatchExecutionResult], error) {
+	cOpts := append([]grpc.CallOption{grpc.StaticMethod()}, opts...)
+	stream, err := c.cc.NewStream(ctx, &SolutionEvaluationService_ServiceDesc.Streams[0], SolutionEvaluationService_EvaluateSolutionsBatch_FullMethodName, cOpts...)
+	if err != nil {
+		return nil, err
+	}
+	x := &grpc.GenericClientStream[BatchExecutionRequest, BatchExecutionResult]{ClientStream: stream}
+	if err := x.ClientStream.SendMsg(in); err != nil {
+		return nil, err
+	}
+	if err := x.ClientStream.CloseSend(); err != nil {
+		return nil, err
+	}
+	return x, nil
+}
+
+// This type alias is provided for backwards compatibility with existing code that references the prior non-generic stream type by name.
+type SolutionEvaluationService_EvaluateSolutionsBatchClient = grpc.ServerStreamingClient[BatchExecutionResult]
+
+func (c *solutionEvaluationServiceClient) EvaluateSolutionStream(ctx context.Context, in *ExecutionRequest, opts ...grpc.CallOption) (grpc.ServerStreamingClient[ExecutionProgress], error) {
+	cOpts := append([]grpc.CallOption{grpc.StaticMethod()}, opts...)
+	stream, err := c.cc.NewStream(ctx, &SolutionEvaluationService_ServiceDesc.Streams[1], SolutionEvaluationService_EvaluateSolutionStream_FullMethodName, cOpts...)
+	if err != nil {
+		return nil, err
+	}
+	x := &grpc.GenericClientStream[ExecutionRequest, ExecutionProgress]{ClientStream: stream}
+	if err := x.ClientStream.SendMsg(in); err != nil {
+		return nil, err
+	}
+	if err := x.ClientStream.CloseSend(); err != nil {
+		return nil, err
+	}
+	return x, nil
+}
+
+// This type alias is provided for backwards compatibility with existing code that references the prior non-generic stream type by name.
+type SolutionEvaluationService_EvaluateSolutionStreamClient = grpc.ServerStreamingClient[ExecutionProgress]
+
 // SolutionEvaluationServiceServer is the server API for SolutionEvaluationService service.
 // All implementations must embed UnimplementedSolutionEvaluationServiceServer
 // for forward compatibility.
@@ -58,6 +104,12 @@ func (c *solutionEvaluationServiceClient) EvaluateSolution(ctx context.Context,
 type SolutionEvaluationServiceServer interface {
 	// Execute solution code and return approved test IDs
 	EvaluateSolution(context.Context, *ExecutionRequest) (*ExecutionResponse, error)
+	// Evaluate many submissions at once (e.g. regrading a cohort); identical code is
+	// executed only once and results are streamed back as they complete
+	EvaluateSolutionsBatch(*BatchExecutionRequest, grpc.ServerStreamingServer[BatchExecutionResult]) error
+	// Same as EvaluateSolution, but streams progress events (queued, compiling, compiled,
+	// running, one per test as it finishes) and ends with a done event carrying the response
+	EvaluateSolutionStream(*ExecutionRequest, grpc.ServerStreamingServer[ExecutionProgress]) error
 	mustEmbedUnimplementedSolutionEvaluationServiceServer()
 }
 
@@ -71,6 +123,12 @@ type UnimplementedSolutionEvaluationServiceServer struct{}
 func (UnimplementedSolutionEvaluationServiceServer) EvaluateSolution(context.Context, *ExecutionRequest) (*ExecutionResponse, error) {
 	return nil, status.Errorf(codes.Unimplemented, "method EvaluateSolution not implemented")
 }
+func (UnimplementedSolutionEvaluationServiceServer) EvaluateSolutionsBatch(*BatchExecutionRequest, grpc.ServerStreamingServer[BatchExecutionResult]) error {
+	return status.Errorf(codes.Unimplemented, "method EvaluateSolutionsBatch not implemented")
+}
+func (UnimplementedSolutionEvaluationServiceServer) EvaluateSolutionStream(*ExecutionRequest, grpc.ServerStreamingServer[ExecutionProgress]) error {
+	return status.Errorf(codes.Unimplemented, "method EvaluateSolutionStream not implemented")
+}
 func (UnimplementedSolutionEvaluationServiceServer) mustEmbedUnimplementedSolutionEvaluationServiceServer() {
 }
 func (UnimplementedSolutionEvaluationServiceServer) testEmbeddedByValue() {}
@@ -111,6 +169,28 @@ func _SolutionEvaluationService_EvaluateSolution_Handler(srv interface{}, ctx co
 	return interceptor(ctx, in, info, handler)
 }
 
+func _SolutionEvaluationService_EvaluateSolutionsBatch_Handler(srv interface{}, stream grpc.ServerStream) error {
+	m := new(BatchExecutionRequest)
+	if err := stream.RecvMsg(m); err != nil {
+		return err
+	}
+	return srv.(SolutionEvaluationServiceServer).EvaluateSolutionsBatch(m, &grpc.GenericServerStream[BatchExecutionRequest, BatchExecutionResult]{ServerStream: stream})
+}
+
+// This type alias is provided for backwards compatibility with existing code that references the prior non-generic stream type by name.
+type SolutionEvaluationService_EvaluateSolutionsBatchServer = grpc.ServerStreamingServer[BatchExecutionResult]
+
+func _SolutionEvaluationService_EvaluateSolutionStream_Handler(srv interface{}, stream grpc.ServerStream) error {
+	m := new(ExecutionRequest)
+	if err := stream.RecvMsg(m); err != nil {
+		return err
+	}
+	return srv.(SolutionEvaluationServiceServer).EvaluateSolutionStream(m, &grpc.GenericServerStream[ExecutionRequest, ExecutionProgress]{ServerStream: stream})
+}
+
+// This type alias is provided for backwards compatibility with existing code that references the prior non-generic stream type by name.
+type SolutionEvaluationService_EvaluateSolutionStreamServer = grpc.ServerStreamingServer[ExecutionProgress]
+
 // SolutionEvaluationService_ServiceDesc is the grpc.ServiceDesc for SolutionEvaluationService service.
 // It's only intended for direct use with grpc.RegisterService,
 // and not to be introspected or modified (even as a copy)
@@ -123,6 +203,17 @@ var SolutionEvaluationService_ServiceDesc = grpc.ServiceDesc{
 			Handler:    _SolutionEvaluationService_EvaluateSolution_Handler,
 		},
 	},
-	Streams:  []grpc.StreamDesc{},
+	Streams: []grpc.StreamDesc{
+		{
+			StreamName:    "EvaluateSolutionsBatch",
+			Handler:       _SolutionEvaluationService_EvaluateSolutionsBatch_Handler,
+			ServerStreams: true,
+		},
+		{
+			StreamName:    "EvaluateSolutionStream",
+			Handler:       _SolutionEvaluationService_EvaluateSolutionStream_Handler,
+			ServerStreams: true,
+		},
+	},
 	Metadata: "code_runner.proto",
 }
@@ -23,15 +23,18 @@ const (
 
 // Request for code execution from Spring Boot
 type ExecutionRequest struct {
-	state         protoimpl.MessageState `protogen:"open.v1"`
-	ChallengeId   string                 `protobuf:"bytes,1,opt,name=challenge_id,json=challengeId,proto3" json:"challenge_id,omitempty"`
-	CodeVersionId string                 `protobuf:"bytes,2,opt,name=code_version_id,json=codeVersionId,proto3" json:"code_version_id,omitempty"`
-	StudentId     string                 `protobuf:"bytes,3,opt,name=student_id,json=studentId,proto3" json:"student_id,omitempty"`
-	Code          string                 `protobuf:"bytes,4,opt,name=code,proto3" json:"code,omitempty"`
-	Tests         []*TestCase            `protobuf:"bytes,5,rep,name=tests,proto3" json:"tests,omitempty"`
-	Language      string                 `protobuf:"bytes,6,opt,name=language,proto3" json:"language,omitempty"`
-	unknownFields protoimpl.UnknownFields
-	sizeCache     protoimpl.SizeCache
+	state           protoimpl.MessageState `protogen:"open.v1"`
+	ChallengeId     string                 `protobuf:"bytes,1,opt,name=challenge_id,json=challengeId,proto3" json:"challenge_id,omitempty"`
+	CodeVersionId   string                 `protobuf:"bytes,2,opt,name=code_version_id,json=codeVersionId,proto3" json:"code_version_id,omitempty"`
+	StudentId       string                 `protobuf:"bytes,3,opt,name=student_id,json=studentId,proto3" json:"student_id,omitempty"`
+	Code            string                 `protobuf:"bytes,4,opt,name=code,proto3" json:"code,omitempty"`
+	Tests           []*TestCase            `protobuf:"bytes,5,rep,name=tests,proto3" json:"tests,omitempty"`
+	Language        string                 `protobuf:"bytes,6,opt,name=language,proto3" json:"language,omitempty"`
+	FailFast        bool                   `protobuf:"varint,7,opt,name=fail_fast,json=failFast,proto3" json:"fail_fast,omitempty"`                          // Stop at the first failing test; the rest are reported as not run
+	CompilerProfile *CompilerProfile       `protobuf:"bytes,8,opt,name=compiler_profile,json=compilerProfile,proto3" json:"compiler_profile,omitempty"`      // How to compile the solution (defaults to gcc, c++17, O0)
+	TestTimeLimitMs int32                  `protobuf:"varint,9,opt,name=test_time_limit_ms,json=testTimeLimitMs,proto3" json:"test_time_limit_ms,omitempty"` // Wall-clock budget per test, over it the test fails as time_limit_exceeded (0 = service default)
+	unknownFields   protoimpl.UnknownFields
+	sizeCache       protoimpl.SizeCache
 }
 
 func (x *ExecutionRequest) Reset() {
@@ -106,6 +109,104 @@ func (x *ExecutionRequest) GetLanguage() string {
 	return ""
 }
 
+func (x *ExecutionRequest) GetFailFast() bool {
+	if x != nil {
+		return x.FailFast
+	}
+	return false
+}
+
+func (x *ExecutionRequest) GetCompilerProfile() *CompilerProfile {
+	if x != nil {
+		return x.CompilerProfile
+	}
+	return nil
+}
+
+func (x *ExecutionRequest) GetTestTimeLimitMs() int32 {
+	if x != nil {
+		return x.TestTimeLimitMs
+	}
+	return 0
+}
+
+// Compiler profile; every field is checked against the values the sandbox image supports
+type CompilerProfile struct {
+	state         protoimpl.MessageState `protogen:"open.v1"`
+	Compiler      string                 `protobuf:"bytes,1,opt,name=compiler,proto3" json:"compiler,omitempty"`         // "gcc" (default) or "clang"
+	Standard      string                 `protobuf:"bytes,2,opt,name=standard,proto3" json:"standard,omitempty"`         // "c++14", "c++17" (default) or "c++20"
+	Optimization  string                 `protobuf:"bytes,3,opt,name=optimization,proto3" json:"optimization,omitempty"` // "O0" (default), "O1", "O2", "O3" or "Os"
+	March         string                 `protobuf:"bytes,4,opt,name=march,proto3" json:"march,omitempty"`               // "" (baseline), "x86-64-v2" or "x86-64-v3"
+	Sanitizers    bool                   `protobuf:"varint,5,opt,name=sanitizers,proto3" json:"sanitizers,omitempty"`    // Build with AddressSanitizer and UndefinedBehaviorSanitizer
+	unknownFields protoimpl.UnknownFields
+	sizeCache     protoimpl.SizeCache
+}
+
+func (x *CompilerProfile) Reset() {
+	*x = CompilerProfile{}
+	mi := &file_api_proto_code_runner_proto_msgTypes[1]
+	ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+	ms.StoreMessageInfo(mi)
+}
+
+func (x *CompilerProfile) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*CompilerProfile) ProtoMessage() {}
+
+func (x *CompilerProfile) ProtoReflect() protoreflect.Message {
+	mi := &file_api_proto_code_runner_proto_msgTypes[1]
+	if x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use CompilerProfile.ProtoReflect.Descriptor instead.
+func (*CompilerProfile) Descriptor() ([]byte, []int) {
+	return file_api_proto_code_runner_proto_rawDescGZIP(), []int{1}
+}
+
+func (x *CompilerProfile) GetCompiler() string {
+	if x != nil {
+		return x.Compiler
+	}
+	return ""
+}
+
+func (x *CompilerProfile) GetStandard() string {
+	if x != nil {
+		return x.Standard
+	}
+	return ""
+}
+
+func (x *CompilerProfile) GetOptimization() string {
+	if x != nil {
+		return x.Optimization
+	}
+	return ""
+}
+
+func (x *CompilerProfile) GetMarch() string {
+	if x != nil {
+		return x.March
+	}
+	return ""
+}
+
+func (x *CompilerProfile) GetSanitizers() bool {
+	if x != nil {
+		return x.Sanitizers
+	}
+	return false
+}
+
 // Test case definition
 type TestCase struct {
 	state                protoimpl.MessageState `protogen:"open.v1"`
@@ -119,7 +220,7 @@ type TestCase struct {
 
 func (x *TestCase) Reset() {
 	*x = TestCase{}
-	mi := &file_api_proto_code_runner_proto_msgTypes[1]
+	mi := &file_api_proto_code_runner_proto_msgTypes[2]
 	ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 	ms.StoreMessageInfo(mi)
 }
@@ -131,7 +232,7 @@ func (x *TestCase) String() string {
 func (*TestCase) ProtoMessage() {}
 
 func (x *TestCase) ProtoReflect() protoreflect.Message {
-	mi := &file_api_proto_code_runner_proto_msgTypes[1]
+	mi := &file_api_proto_code_runner_proto_msgTypes[2]
 	if x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -144,7 +245,7 @@ func (x *TestCase) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use TestCase.ProtoReflect.Descriptor instead.
 func (*TestCase) Descriptor() ([]byte, []int) {
-	return file_api_proto_code_runner_proto_rawDescGZIP(), []int{1}
+	return file_api_proto_code_runner_proto_rawDescGZIP(), []int{2}
 }
 
 func (x *TestCase) GetCodeVersionTestId() string {
@@ -194,7 +295,7 @@ type ExecutionResponse struct {
 
 func (x *ExecutionResponse) Reset() {
 	*x = ExecutionResponse{}
-	mi := &file_api_proto_code_runner_proto_msgTypes[2]
+	mi := &file_api_proto_code_runner_proto_msgTypes[3]
 	ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 	ms.StoreMessageInfo(mi)
 }
@@ -206,7 +307,7 @@ func (x *ExecutionResponse) String() string {
 func (*ExecutionResponse) ProtoMessage() {}
 
 func (x *ExecutionResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_api_proto_code_runner_proto_msgTypes[2]
+	mi := &file_api_proto_code_runner_proto_msgTypes[3]
 	if x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -219,7 +320,7 @@ func (x *ExecutionResponse) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use ExecutionResponse.ProtoReflect.Descriptor instead.
 func (*ExecutionResponse) Descriptor() ([]byte, []int) {
-	return file_api_proto_code_runner_proto_rawDescGZIP(), []int{2}
+	return file_api_proto_code_runner_proto_rawDescGZIP(), []int{3}
 }
 
 func (x *ExecutionResponse) GetApprovedTests() []string {
@@ -292,11 +393,218 @@ func (x *ExecutionResponse) GetErrorType() string {
 	return ""
 }
 
+// Batch of submissions to evaluate
+type BatchExecutionRequest struct {
+	state         protoimpl.MessageState `protogen:"open.v1"`
+	Submissions   []*ExecutionRequest    `protobuf:"bytes,1,rep,name=submissions,proto3" json:"submissions,omitempty"`
+	unknownFields protoimpl.UnknownFields
+	sizeCache     protoimpl.SizeCache
+}
+
+func (x *BatchExecutionRequest) Reset() {
+	*x = BatchExecutionRequest{}
+	mi := &file_api_proto_code_runner_proto_msgTypes[4]
+	ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+	ms.StoreMessageInfo(mi)
+}
+
+func (x *BatchExecutionRequest) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*BatchExecutionRequest) ProtoMessage() {}
+
+func (x *BatchExecutionRequest) ProtoReflect() protoreflect.Message {
+	mi := &file_api_proto_code_runner_proto_msgTypes[4]
+	if x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use BatchExecutionRequest.ProtoReflect.Descriptor instead.
+func (*BatchExecutionRequest) Descriptor() ([]byte, []int) {
+	return file_api_proto_code_runner_proto_rawDescGZIP(), []int{4}
+}
+
+func (x *BatchExecutionRequest) GetSubmissions() []*ExecutionRequest {
+	if x != nil {
+		return x.Submissions
+	}
+	return nil
+}
+
+// Result of one submission of a batch, in completion order
+type BatchExecutionResult struct {
+	state         protoimpl.MessageState `protogen:"open.v1"`
+	Index         int32                  `protobuf:"varint,1,opt,name=index,proto3" json:"index,omitempty"` // Position of the submission in the request
+	StudentId     string                 `protobuf:"bytes,2,opt,name=student_id,json=studentId,proto3" json:"student_id,omitempty"`
+	Response      *ExecutionResponse     `protobuf:"bytes,3,opt,name=response,proto3" json:"response,omitempty"`
+	Deduplicated  bool                   `protobuf:"varint,4,opt,name=deduplicated,proto3" json:"deduplicated,omitempty"` // Result reused from an identical submission of the batch
+	unknownFields protoimpl.UnknownFields
+	sizeCache     protoimpl.SizeCache
+}
+
+func (x *BatchExecutionResult) Reset() {
+	*x = BatchExecutionResult{}
+	mi := &file_api_proto_code_runner_proto_msgTypes[5]
+	ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+	ms.StoreMessageInfo(mi)
+}
+
+func (x *BatchExecutionResult) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*BatchExecutionResult) ProtoMessage() {}
+
+func (x *BatchExecutionResult) ProtoReflect() protoreflect.Message {
+	mi := &file_api_proto_code_runner_proto_msgTypes[5]
+	if x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use BatchExecutionResult.ProtoReflect.Descriptor instead.
+func (*BatchExecutionResult) Descriptor() ([]byte, []int) {
+	return file_api_proto_code_runner_proto_rawDescGZIP(), []int{5}
+}
+
+func (x *BatchExecutionResult) GetIndex() int32 {
+	if x != nil {
+		return x.Index
+	}
+	return 0
+}
+
+func (x *BatchExecutionResult) GetStudentId() string {
+	if x != nil {
+		return x.StudentId
+	}
+	return ""
+}
+
+func (x *BatchExecutionResult) GetResponse() *ExecutionResponse {
+	if x != nil {
+		return x.Response
+	}
+	return nil
+}
+
+func (x *BatchExecutionResult) GetDeduplicated() bool {
+	if x != nil {
+		return x.Deduplicated
+	}
+	return false
+}
+
+// Progress event of a streamed evaluation
+type ExecutionProgress struct {
+	state          protoimpl.MessageState `protogen:"open.v1"`
+	Phase          string                 `protobuf:"bytes,1,opt,name=phase,proto3" json:"phase,omitempty"`                                            // queued, compiling, compiled, running, test, done
+	ElapsedMs      int64                  `protobuf:"varint,2,opt,name=elapsed_ms,json=elapsedMs,proto3" json:"elapsed_ms,omitempty"`                  // Time since the request was received
+	TestId         string                 `protobuf:"bytes,3,opt,name=test_id,json=testId,proto3" json:"test_id,omitempty"`                            // Only for test events
+	Passed         bool                   `protobuf:"varint,4,opt,name=passed,proto3" json:"passed,omitempty"`                                         // Only for test events
+	TestDurationMs int64                  `protobuf:"varint,5,opt,name=test_duration_ms,json=testDurationMs,proto3" json:"test_duration_ms,omitempty"` // Only for test events
+	Message        string                 `protobuf:"bytes,6,opt,name=message,proto3" json:"message,omitempty"`
+	Response       *ExecutionResponse     `protobuf:"bytes,7,opt,name=response,proto3" json:"response,omitempty"` // Only for the done event
+	unknownFields  protoimpl.UnknownFields
+	sizeCache      protoimpl.SizeCache
+}
+
+func (x *ExecutionProgress) Reset() {
+	*x = ExecutionProgress{}
+	mi := &file_api_proto_code_runner_proto_msgTypes[6]
+	ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+	ms.StoreMessageInfo(mi)
+}
+
+func (x *ExecutionProgress) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*ExecutionProgress) ProtoMessage() {}
+
+func (x *ExecutionProgress) ProtoReflect() protoreflect.Message {
+	mi := &file_api_proto_code_runner_proto_msgTypes[6]
+	if x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use ExecutionProgress.ProtoReflect.Descriptor instead.
+func (*ExecutionProgress) Descriptor() ([]byte, []int) {
+	return file_api_proto_code_runner_proto_rawDescGZIP(), []int{6}
+}
+
+func (x *ExecutionProgress) GetPhase() string {
+	if x != nil {
+		return x.Phase
+	}
+	return ""
+}
+
+func (x *ExecutionProgress) GetElapsedMs() int64 {
+	if x != nil {
+		return x.ElapsedMs
+	}
+	return 0
+}
+
+func (x *ExecutionProgress) GetTestId() string {
+	if x != nil {
+		return x.TestId
+	}
+	return ""
+}
+
+func (x *ExecutionProgress) GetPassed() bool {
+	if x != nil {
+		return x.Passed
+	}
+	return false
+}
+
+func (x *ExecutionProgress) GetTestDurationMs() int64 {
+	if x != nil {
+		return x.TestDurationMs
+	}
+	return 0
+}
+
+func (x *ExecutionProgress) GetMessage() string {
+	if x != nil {
+		return x.Message
+	}
+	return ""
+}
+
+func (x *ExecutionProgress) GetResponse() *ExecutionResponse {
+	if x != nil {
+		return x.Response
+	}
+	return nil
+}
+
 var File_api_proto_code_runner_proto protoreflect.FileDescriptor
 
 const file_api_proto_code_runner_proto_rawDesc = "" +
 	"\n" +
-	"\x1bapi/proto/code_runner.proto\x12\x1dcom.levelupjourney.coderunner\"\xeb\x01\n" +
+	"\x1bapi/proto/code_runner.proto\x12\x1dcom.levelupjourney.coderunner\"\x90\x03\n" +
 	"\x10ExecutionRequest\x12!\n" +
 	"\fchallenge_id\x18\x01 \x01(\tR\vchallengeId\x12&\n" +
 	"\x0fcode_version_id\x18\x02 \x01(\tR\rcodeVersionId\x12\x1d\n" +
@@ -304,7 +612,18 @@ const file_api_proto_code_runner_proto_rawDesc = "" +
 	"student_id\x18\x03 \x01(\tR\tstudentId\x12\x12\n" +
 	"\x04code\x18\x04 \x01(\tR\x04code\x12=\n" +
 	"\x05tests\x18\x05 \x03(\v2'.com.levelupjourney.coderunner.TestCaseR\x05tests\x12\x1a\n" +
-	"\blanguage\x18\x06 \x01(\tR\blanguage\"\xb0\x01\n" +
+	"\blanguage\x18\x06 \x01(\tR\blanguage\x12\x1b\n" +
+	"\tfail_fast\x18\a \x01(\bR\bfailFast\x12Y\n" +
+	"\x10compiler_profile\x18\b \x01(\v2..com.levelupjourney.coderunner.CompilerProfileR\x0fcompilerProfile\x12+\n" +
+	"\x12test_time_limit_ms\x18\t \x01(\x05R\x0ftestTimeLimitMs\"\xa3\x01\n" +
+	"\x0fCompilerProfile\x12\x1a\n" +
+	"\bcompiler\x18\x01 \x01(\tR\bcompiler\x12\x1a\n" +
+	"\bstandard\x18\x02 \x01(\tR\bstandard\x12\"\n" +
+	"\foptimization\x18\x03 \x01(\tR\foptimization\x12\x14\n" +
+	"\x05march\x18\x04 \x01(\tR\x05march\x12\x1e\n" +
+	"\n" +
+	"sanitizers\x18\x05 \x01(\bR\n" +
+	"sanitizers\"\xb0\x01\n" +
 	"\bTestCase\x12/\n" +
 	"\x14code_version_test_id\x18\x01 \x01(\tR\x11codeVersionTestId\x12\x14\n" +
 	"\x05input\x18\x02 \x01(\tR\x05input\x12'\n" +
@@ -323,9 +642,28 @@ const file_api_proto_code_runner_proto_rawDesc = "" +
 	"\rerror_message\x18\t \x01(\tR\ferrorMessage\x12\x1d\n" +
 	"\n" +
 	"error_type\x18\n" +
-	" \x01(\tR\terrorType2\x92\x01\n" +
+	" \x01(\tR\terrorType\"j\n" +
+	"\x15BatchExecutionRequest\x12Q\n" +
+	"\vsubmissions\x18\x01 \x03(\v2/.com.levelupjourney.coderunner.ExecutionRequestR\vsubmissions\"\xbd\x01\n" +
+	"\x14BatchExecutionResult\x12\x14\n" +
+	"\x05index\x18\x01 \x01(\x05R\x05index\x12\x1d\n" +
+	"\n" +
+	"student_id\x18\x02 \x01(\tR\tstudentId\x12L\n" +
+	"\bresponse\x18\x03 \x01(\v20.com.levelupjourney.coderunner.ExecutionResponseR\bresponse\x12\"\n" +
+	"\fdeduplicated\x18\x04 \x01(\bR\fdeduplicated\"\x8b\x02\n" +
+	"\x11ExecutionProgress\x12\x14\n" +
+	"\x05phase\x18\x01 \x01(\tR\x05phase\x12\x1d\n" +
+	"\n" +
+	"elapsed_ms\x18\x02 \x01(\x03R\telapsedMs\x12\x17\n" +
+	"\atest_id\x18\x03 \x01(\tR\x06testId\x12\x16\n" +
+	"\x06passed\x18\x04 \x01(\bR\x06passed\x12(\n" +
+	"\x10test_duration_ms\x18\x05 \x01(\x03R\x0etestDurationMs\x12\x18\n" +
+	"\amessage\x18\x06 \x01(\tR\amessage\x12L\n" +
+	"\bresponse\x18\a \x01(\v20.com.levelupjourney.coderunner.ExecutionResponseR\bresponse2\x99\x03\n" +
 	"\x19SolutionEvaluationService\x12u\n" +
-	"\x10EvaluateSolution\x12/.com.levelupjourney.coderunner.ExecutionRequest\x1a0.com.levelupjourney.coderunner.ExecutionResponseBv\n" +
+	"\x10EvaluateSolution\x12/.com.levelupjourney.coderunner.ExecutionRequest\x1a0.com.levelupjourney.coderunner.ExecutionResponse\x12\x85\x01\n" +
+	"\x16EvaluateSolutionsBatch\x124.com.levelupjourney.coderunner.BatchExecutionRequest\x1a3.com.levelupjourney.coderunner.BatchExecutionResult0\x01\x12}\n" +
+	"\x16EvaluateSolutionStream\x12/.com.levelupjourney.coderunner.ExecutionRequest\x1a0.com.levelupjourney.coderunner.ExecutionProgress0\x01Bv\n" +
 	"Ccom.levelupjourney.microservicechallenges.solutions.interfaces.grpcB\x12CodeExecutionProtoP\x01Z\x19code-runner/api/gen/protob\x06proto3"
 
 var (
@@ -340,21 +678,33 @@ func file_api_proto_code_runner_proto_rawDescGZIP() []byte {
 	return file_api_proto_code_runner_proto_rawDescData
 }
 
-var file_api_proto_code_runner_proto_msgTypes = make([]protoimpl.MessageInfo, 3)
+var file_api_proto_code_runner_proto_msgTypes = make([]protoimpl.MessageInfo, 7)
 var file_api_proto_code_runner_proto_goTypes = []any{
-	(*ExecutionRequest)(nil),  // 0: com.levelupjourney.coderunner.ExecutionRequest
-	(*TestCase)(nil),          // 1: com.levelupjourney.coderunner.TestCase
-	(*ExecutionResponse)(nil), // 2: com.levelupjourney.coderunner.ExecutionResponse
+	(*ExecutionRequest)(nil),      // 0: com.levelupjourney.coderunner.ExecutionRequest
+	(*CompilerProfile)(nil),       // 1: com.levelupjourney.coderunner.CompilerProfile
+	(*TestCase)(nil),              // 2: com.levelupjourney.coderunner.TestCase
+	(*ExecutionResponse)(nil),     // 3: com.levelupjourney.coderunner.ExecutionResponse
+	(*BatchExecutionRequest)(nil), // 4: com.levelupjourney.coderunner.BatchExecutionRequest
+	(*BatchExecutionResult)(nil),  // 5: com.levelupjourney.coderunner.BatchExecutionResult
+	(*ExecutionProgress)(nil),     // 6: com.levelupjourney.coderunner.ExecutionProgress
 }
 var file_api_proto_code_runner_proto_depIdxs = []int32{
-	1, // 0: com.levelupjourney.coderunner.ExecutionRequest.tests:type_name -> com.levelupjourney.coderunner.TestCase
-	0, // 1: com.levelupjourney.coderunner.SolutionEvaluationService.EvaluateSolution:input_type -> com.levelupjourney.coderunner.ExecutionRequest
-	2, // 2: com.levelupjourney.coderunner.SolutionEvaluationService.EvaluateSolution:output_type -> com.levelupjourney.coderunner.ExecutionResponse
-	2, // [2:3] is the sub-list for method output_type
-	1, // [1:2] is the sub-list for method input_type
-	1, // [1:1] is the sub-list for extension type_name
-	1, // [1:1] is the sub-list for extension extendee
-	0, // [0:1] is the sub-list for field type_name
+	2, // 0: com.levelupjourney.coderunner.ExecutionRequest.tests:type_name -> com.levelupjourney.coderunner.TestCase
+	1, // 1: com.levelupjourney.coderunner.ExecutionRequest.compiler_profile:type_name -> com.levelupjourney.coderunner.CompilerProfile
+	0, // 2: com.levelupjourney.coderunner.BatchExecutionRequest.submissions:type_name -> com.levelupjourney.coderunner.ExecutionRequest
+	3, // 3: com.levelupjourney.coderunner.BatchExecutionResult.response:type_name -> com.levelupjourney.coderunner.ExecutionResponse
+	3, // 4: com.levelupjourney.coderunner.ExecutionProgress.response:type_name -> com.levelupjourney.coderunner.ExecutionResponse
+	0, // 5: com.levelupjourney.coderunner.SolutionEvaluationService.EvaluateSolution:input_type -> com.levelupjourney.coderunner.ExecutionRequest
+	4, // 6: com.levelupjourney.coderunner.SolutionEvaluationService.EvaluateSolutionsBatch:input_type -> com.levelupjourney.coderunner.BatchExecutionRequest
+	0, // 7: com.levelupjourney.coderunner.SolutionEvaluationService.EvaluateSolutionStream:input_type -> com.levelupjourney.coderunner.ExecutionRequest
+	3, // 8: com.levelupjourney.coderunner.SolutionEvaluationService.EvaluateSolution:output_type -> com.levelupjourney.coderunner.ExecutionResponse
+	5, // 9: com.levelupjourney.coderunner.SolutionEvaluationService.EvaluateSolutionsBatch:output_type -> com.levelupjourney.coderunner.BatchExecutionResult
+	6, // 10: com.levelupjourney.coderunner.SolutionEvaluationService.EvaluateSolutionStream:output_type -> com.levelupjourney.coderunner.ExecutionProgress
+	8, // [8:11] is the sub-list for method output_type
+	5, // [5:8] is the sub-list for method input_type
+	5, // [5:5] is the sub-list for extension type_name
+	5, // [5:5] is the sub-list for extension extendee
+	0, // [0:5] is the sub-list for field type_name
 }
 
 func init() { file_api_proto_code_runner_proto_init() }
@@ -368,7 +718,7 @@ func file_api_proto_code_runner_proto_init() {
 			GoPackagePath: reflect.TypeOf(x{}).PkgPath(),
 			RawDescriptor: unsafe.Slice(unsafe.StringData(file_api_proto_code_runner_proto_rawDesc), len(file_api_proto_code_runner_proto_rawDesc)),
 			NumEnums:      0,
-			NumMessages:   3,
+			NumMessages:   7,
 			NumExtensions: 0,
 			NumServices:   1,
 		},
@@ -0,0 +1,185 @@
+package main
+
+import (
+	"encoding/json"
+	"fmt"
+	"math/rand"
+	"os"
+	"strings"
+
+	"github.com/google/uuid"
+
+	pb "code-runner/api/gen/proto"
+)
+
+// Tipos de envío del corpus incorporado
+const (
+	kindCorrect      = "correct"
+	kindWrong        = "wrong"
+	kindCompileError = "compile_error"
+	kindTimeout      = "timeout"
+	kindCrash        = "crash"
+)
+
+// Submission es un envío del corpus: el código del estudiante y sus tests. Weight es su
+// peso relativo al elegir el siguiente envío a reproducir.
+type Submission struct {
+	Name   string           `json:"name"`
+	Kind   string           `json:"kind"`
+	Weight int              `json:"weight"`
+	Code   string           `json:"code"`
+	Tests  []SubmissionTest `json:"tests"`
+}
+
+// SubmissionTest es un caso de prueba de un envío
+type SubmissionTest struct {
+	Input                string `json:"input"`
+	ExpectedOutput       string `json:"expected_output"`
+	CustomValidationCode string `json:"custom_validation_code,omitempty"`
+}
+
+// sumToTests son los tests de la función sumTo(n) = 1 + 2 + ... + n del corpus incorporado
+var sumToTests = []SubmissionTest{
+	{Input: "1", ExpectedOutput: "1"},
+	{Input: "10", ExpectedOutput: "55"},
+	{Input: "100", ExpectedOutput: "5050"},
+	{Input: "1000", ExpectedOutput: "500500"},
+}
+
+// builtinCorpus retorna un envío por cada resultado que el servicio debe manejar
+func builtinCorpus() []Submission {
+	return []Submission{
+		{
+			Name: "sum-loop", Kind: kindCorrect, Weight: 50, Tests: sumToTests,
+			Code: "int sumTo(int n) {\n    int total = 0;\n    for (int i = 1; i <= n; i++) {\n        total += i;\n    }\n    return total;\n}\n",
+		},
+		{
+			Name: "sum-off-by-one", Kind: kindWrong, Weight: 20, Tests: sumToTests,
+			Code: "int sumTo(int n) {\n    int total = 0;\n    for (int i = 1; i < n; i++) {\n        total += i;\n    }\n    return total;\n}\n",
+		},
+		{
+			Name: "sum-missing-semicolon", Kind: kindCompileError, Weight: 15, Tests: sumToTests,
+			Code: "int sumTo(int n) {\n    int total = 0\n    return total;\n}\n",
+		},
+		{
+			Name: "sum-infinite-loop", Kind: kindTimeout, Weight: 5, Tests: sumToTests,
+			Code: "int sumTo(int n) {\n    volatile long spins = 0;\n    while (n > 0) {\n        spins++;\n    }\n    return 0;\n}\n",
+		},
+		{
+			Name: "sum-null-dereference", Kind: kindCrash, Weight: 10, Tests: sumToTests,
+			Code: "int sumTo(int n) {\n    volatile int* total = nullptr;\n    *total = n;\n    return *total;\n}\n",
+		},
+	}
+}
+
+// loadCorpus lee un corpus en JSON (un arreglo de Submission)
+func loadCorpus(path string) ([]Submission, error) {
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return nil, fmt.Errorf("failed to read corpus: %w", err)
+	}
+
+	var corpus []Submission
+	if err := json.Unmarshal(data, &corpus); err != nil {
+		return nil, fmt.Errorf("failed to parse corpus: %w", err)
+	}
+	if len(corpus) == 0 {
+		return nil, fmt.Errorf("corpus %s is empty", path)
+	}
+	for i := range corpus {
+		if corpus[i].Weight <= 0 {
+			corpus[i].Weight = 1
+		}
+		if corpus[i].Name == "" {
+			corpus[i].Name = fmt.Sprintf("submission-%d", i)
+		}
+	}
+	return corpus, nil
+}
+
+// filterCorpus deja solo los envíos de los tipos indicados (separados por comas; vacío = todos)
+func filterCorpus(corpus []Submission, kinds string) ([]Submission, error) {
+	if kinds == "" {
+		return corpus, nil
+	}
+
+	wanted := make(map[string]bool)
+	for _, kind := range strings.Split(kinds, ",") {
+		wanted[strings.TrimSpace(kind)] = true
+	}
+	var filtered []Submission
+	for _, submission := range corpus {
+		if wanted[submission.Kind] {
+			filtered = append(filtered, submission)
+		}
+	}
+	if len(filtered) == 0 {
+		return nil, fmt.Errorf("no submissions of kinds %q in the corpus", kinds)
+	}
+	return filtered, nil
+}
+
+// picker elige envíos del corpus al azar según su peso
+type picker struct {
+	corpus []Submission
+	total  int
+}
+
+// newPicker crea un selector sobre el corpus
+func newPicker(corpus []Submission) *picker {
+	p := &picker{corpus: corpus}
+	for _, submission := range corpus {
+		p.total += submission.Weight
+	}
+	return p
+}
+
+// pick elige un envío con probabilidad proporcional a su peso
+func (p *picker) pick(rng *rand.Rand) *Submission {
+	n := rng.Intn(p.total)
+	for i := range p.corpus {
+		n -= p.corpus[i].Weight
+		if n < 0 {
+			return &p.corpus[i]
+		}
+	}
+	return &p.corpus[len(p.corpus)-1]
+}
+
+// requestOptions son las opciones de la petición comunes a todos los envíos
+type requestOptions struct {
+	unique          bool // Agregar un comentario distinto a cada envío para evitar los caches
+	failFast        bool
+	testTimeLimitMS int
+}
+
+// buildRequest arma la petición gRPC de un envío. Cada petición lleva IDs nuevos; con
+// unique, además un comentario distinto, para que el cache de compilación y la
+// memoización de resultados no conviertan la prueba en una prueba de los caches.
+func buildRequest(submission *Submission, sequence int64, options requestOptions) *pb.ExecutionRequest {
+	code := submission.Code
+	if options.unique {
+		code = fmt.Sprintf("// loadgen %s #%d\n%s", submission.Name, sequence, code)
+	}
+
+	tests := make([]*pb.TestCase, 0, len(submission.Tests))
+	for _, test := range submission.Tests {
+		tests = append(tests, &pb.TestCase{
+			CodeVersionTestId:    uuid.NewString(),
+			Input:                test.Input,
+			ExpectedOutput:       test.ExpectedOutput,
+			CustomValidationCode: test.CustomValidationCode,
+		})
+	}
+
+	return &pb.ExecutionRequest{
+		ChallengeId:     uuid.NewString(),
+		CodeVersionId:   uuid.NewString(),
+		StudentId:       uuid.NewString(),
+		Code:            code,
+		Tests:           tests,
+		Language:        "cpp",
+		FailFast:        options.failFast,
+		TestTimeLimitMs: int32(options.testTimeLimitMS),
+	}
+}
@@ -0,0 +1,194 @@
+package main
+
+import (
+	"fmt"
+	"io"
+	"math"
+	"math/bits"
+	"time"
+)
+
+// Precisión del histograma: los valores menores que 2*histogramSubBuckets se guardan
+// exactos y los mayores en buckets de ancho proporcional al valor, con un error relativo
+// menor a 1/histogramSubBuckets (~0.1%), como un HDR histogram de 3 cifras significativas
+const (
+	histogramSubBucketBits = 10
+	histogramSubBuckets    = 1 << histogramSubBucketBits
+)
+
+// Histogram es un histograma de latencias de rango dinámico alto (HDR): registra en
+// microsegundos desde 1µs hasta horas con memoria acotada y precisión relativa constante
+type Histogram struct {
+	counts []int64
+	total  int64
+	sum    int64
+	sumSq  float64
+	min    int64
+	max    int64
+}
+
+// NewHistogram crea un histograma vacío
+func NewHistogram() *Histogram {
+	return &Histogram{min: math.MaxInt64}
+}
+
+// bucketIndex retorna el bucket de un valor: exacto por debajo de 2*histogramSubBuckets y,
+// por encima, el exponente del valor más sus histogramSubBucketBits bits más significativos
+func bucketIndex(value int64) int {
+	if value < 2*histogramSubBuckets {
+		return int(value)
+	}
+	shift := bits.Len64(uint64(value)) - histogramSubBucketBits - 1
+	return 2*histogramSubBuckets + (shift-1)*histogramSubBuckets + int(value>>shift) - histogramSubBuckets
+}
+
+// bucketUpperBound retorna el mayor valor que cae en el bucket index
+func bucketUpperBound(index int) int64 {
+	if index < 2*histogramSubBuckets {
+		return int64(index)
+	}
+	offset := index - 2*histogramSubBuckets
+	shift := offset/histogramSubBuckets + 1
+	mantissa := int64(offset%histogramSubBuckets + histogramSubBuckets)
+	return (mantissa+1)<<shift - 1
+}
+
+// Record registra una latencia
+func (h *Histogram) Record(d time.Duration) {
+	value := d.Microseconds()
+	if value < 0 {
+		value = 0
+	}
+
+	index := bucketIndex(value)
+	if index >= len(h.counts) {
+		grown := make([]int64, index+1)
+		copy(grown, h.counts)
+		h.counts = grown
+	}
+	h.counts[index]++
+	h.total++
+	h.sum += value
+	h.sumSq += float64(value) * float64(value)
+	if value < h.min {
+		h.min = value
+	}
+	if value > h.max {
+		h.max = value
+	}
+}
+
+// Merge suma los valores de other a este histograma
+func (h *Histogram) Merge(other *Histogram) {
+	if len(other.counts) > len(h.counts) {
+		grown := make([]int64, len(other.counts))
+		copy(grown, h.counts)
+		h.counts = grown
+	}
+	for i, count := range other.counts {
+		h.counts[i] += count
+	}
+	h.total += other.total
+	h.sum += other.sum
+	h.sumSq += other.sumSq
+	if other.min < h.min {
+		h.min = other.min
+	}
+	if other.max > h.max {
+		h.max = other.max
+	}
+}
+
+// Count retorna la cantidad de valores registrados
+func (h *Histogram) Count() int64 {
+	return h.total
+}
+
+// Min retorna la menor latencia registrada
+func (h *Histogram) Min() time.Duration {
+	if h.total == 0 {
+		return 0
+	}
+	return time.Duration(h.min) * time.Microsecond
+}
+
+// Max retorna la mayor latencia registrada
+func (h *Histogram) Max() time.Duration {
+	return time.Duration(h.max) * time.Microsecond
+}
+
+// Mean retorna la latencia promedio
+func (h *Histogram) Mean() time.Duration {
+	if h.total == 0 {
+		return 0
+	}
+	return time.Duration(h.sum/h.total) * time.Microsecond
+}
+
+// StdDev retorna la desviación estándar de las latencias
+func (h *Histogram) StdDev() time.Duration {
+	if h.total == 0 {
+		return 0
+	}
+	mean := float64(h.sum) / float64(h.total)
+	variance := h.sumSq/float64(h.total) - mean*mean
+	if variance < 0 {
+		variance = 0
+	}
+	return time.Duration(math.Sqrt(variance) * float64(time.Microsecond))
+}
+
+// ValueAtPercentile retorna la latencia bajo la cual está el percentil dado (0-100),
+// con la precisión del bucket que lo contiene
+func (h *Histogram) ValueAtPercentile(percentile float64) time.Duration {
+	if h.total == 0 {
+		return 0
+	}
+
+	target := int64(math.Ceil(percentile / 100 * float64(h.total)))
+	if target < 1 {
+		target = 1
+	}
+	var seen int64
+	for index, count := range h.counts {
+		seen += count
+		if seen >= target {
+			value := bucketUpperBound(index)
+			if value > h.max {
+				value = h.max
+			}
+			return time.Duration(value) * time.Microsecond
+		}
+	}
+	return h.Max()
+}
+
+// WritePercentiles escribe la distribución en el formato de texto .hgrm de HdrHistogram
+// (valor en milisegundos, percentil, cantidad acumulada, 1/(1-percentil)), que se puede
+// graficar con el plotter de HdrHistogram
+func (h *Histogram) WritePercentiles(w io.Writer) error {
+	if _, err := fmt.Fprintf(w, "%12s %14s %10s %14s\n\n", "Value", "Percentile", "TotalCount", "1/(1-Percentile)"); err != nil {
+		return err
+	}
+
+	var seen int64
+	for index, count := range h.counts {
+		if count == 0 {
+			continue
+		}
+		seen += count
+		fraction := float64(seen) / float64(h.total)
+		inverse := "Infinity"
+		if fraction < 1 {
+			inverse = fmt.Sprintf("%.2f", 1/(1-fraction))
+		}
+		value := float64(bucketUpperBound(index)) / 1000
+		if _, err := fmt.Fprintf(w, "%12.3f %14.12f %10d %14s\n", value, fraction, seen, inverse); err != nil {
+			return err
+		}
+	}
+
+	_, err := fmt.Fprintf(w, "#[Mean    = %12.3f, StdDeviation   = %12.3f]\n#[Max     = %12.3f, Total count    = %12d]\n",
+		float64(h.Mean().Microseconds())/1000, float64(h.StdDev().Microseconds())/1000, float64(h.max)/1000, h.total)
+	return err
+}
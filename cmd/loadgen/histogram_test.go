@@ -0,0 +1,45 @@
+package main
+
+import (
+	"testing"
+	"time"
+)
+
+func TestHistogram_Percentiles(t *testing.T) {
+	h := NewHistogram()
+	for i := 1; i <= 10000; i++ {
+		h.Record(time.Duration(i) * time.Millisecond)
+	}
+
+	if h.Count() != 10000 || h.Min() != time.Millisecond || h.Max() != 10*time.Second {
+		t.Fatalf("Unexpected count/min/max: %d %s %s", h.Count(), h.Min(), h.Max())
+	}
+
+	// Buckets keep the relative error below 0.1%
+	for _, tc := range []struct {
+		percentile float64
+		want       time.Duration
+	}{
+		{50, 5 * time.Second},
+		{99, 9900 * time.Millisecond},
+		{99.9, 9990 * time.Millisecond},
+		{100, 10 * time.Second},
+	} {
+		got := h.ValueAtPercentile(tc.percentile)
+		if diff := got - tc.want; diff < 0 || diff > tc.want/1000 {
+			t.Errorf("p%g = %s, want %s (within 0.1%% above)", tc.percentile, got, tc.want)
+		}
+	}
+}
+
+func TestHistogram_BucketBoundaries(t *testing.T) {
+	for _, value := range []int64{0, 1, 2047, 2048, 2049, 4095, 4096, 1 << 20, 3_600_000_000} {
+		index := bucketIndex(value)
+		if upper := bucketUpperBound(index); upper < value {
+			t.Errorf("Value %d in bucket %d with upper bound %d", value, index, upper)
+		}
+		if index > 0 && bucketUpperBound(index-1) >= value {
+			t.Errorf("Value %d also fits the previous bucket %d", value, index-1)
+		}
+	}
+}
@@ -0,0 +1,138 @@
+// loadgen reproduce un corpus de envíos contra el servicio gRPC y mide la latencia por
+// fase (histogramas HDR) y el throughput. Modos:
+//
+//   - closed: -concurrency workers, cada uno envía la siguiente petición al recibir la respuesta
+//   - open:   -rate llegadas por segundo, independientes de las respuestas
+//   - sweep:  lazo cerrado con cada concurrencia de -sweep, para encontrar la saturación
+//
+// Ejemplo: go run ./cmd/loadgen -mode open -rate 4 -duration 2m -warmup 15s
+package main
+
+import (
+	"context"
+	"flag"
+	"fmt"
+	"log"
+	"os"
+	"os/signal"
+	"strconv"
+	"strings"
+	"time"
+
+	"google.golang.org/grpc"
+	"google.golang.org/grpc/credentials/insecure"
+
+	pb "code-runner/api/gen/proto"
+)
+
+func main() {
+	addr := flag.String("addr", "127.0.0.1:9084", "gRPC address of the code runner")
+	mode := flag.String("mode", "closed", "load mode: closed, open or sweep")
+	concurrency := flag.Int("concurrency", 4, "requests in flight (closed mode)")
+	rate := flag.Float64("rate", 2, "arrivals per second (open mode)")
+	maxInFlight := flag.Int("max-inflight", 256, "arrivals beyond this many unanswered requests are dropped (open mode)")
+	sweep := flag.String("sweep", "1,2,4,8,16", "comma-separated concurrency levels (sweep mode)")
+	duration := flag.Duration("duration", time.Minute, "measured duration (per level in sweep mode)")
+	warmup := flag.Duration("warmup", 10*time.Second, "unmeasured warm-up before each run")
+	corpusPath := flag.String("corpus", "", "JSON corpus of submissions (default: built-in corpus)")
+	kinds := flag.String("kinds", "", "only replay these submission kinds, comma-separated")
+	unique := flag.Bool("unique", true, "make every submission unique so the compile and result caches do not hit")
+	stream := flag.Bool("stream", true, "use EvaluateSolutionStream to measure each phase (false: EvaluateSolution, total only)")
+	failFast := flag.Bool("fail-fast", false, "send fail_fast requests")
+	testTimeLimit := flag.Int("test-time-limit-ms", 0, "per-test time limit to request (0 = service default)")
+	requestTimeout := flag.Duration("request-timeout", 2*time.Minute, "deadline of each request")
+	hgrmDir := flag.String("hgrm-dir", "", "write the per-phase distributions as .hgrm files to this directory")
+	seed := flag.Int64("seed", 1, "seed of the submission picker")
+	flag.Parse()
+
+	corpus := builtinCorpus()
+	if *corpusPath != "" {
+		loaded, err := loadCorpus(*corpusPath)
+		if err != nil {
+			log.Fatalf("❌ %v", err)
+		}
+		corpus = loaded
+	}
+	corpus, err := filterCorpus(corpus, *kinds)
+	if err != nil {
+		log.Fatalf("❌ %v", err)
+	}
+
+	conn, err := grpc.NewClient(*addr, grpc.WithTransportCredentials(insecure.NewCredentials()))
+	if err != nil {
+		log.Fatalf("❌ Failed to connect: %v", err)
+	}
+	defer conn.Close()
+
+	ctx, stop := signal.NotifyContext(context.Background(), os.Interrupt)
+	defer stop()
+
+	config := &runConfig{
+		client:         pb.NewSolutionEvaluationServiceClient(conn),
+		picker:         newPicker(corpus),
+		options:        requestOptions{unique: *unique, failFast: *failFast, testTimeLimitMS: *testTimeLimit},
+		stream:         *stream,
+		requestTimeout: *requestTimeout,
+		duration:       *duration,
+		warmup:         *warmup,
+		seed:           *seed,
+	}
+
+	log.Printf("🚀 Load test against %s: mode=%s, %d submissions in the corpus", *addr, *mode, len(corpus))
+
+	switch *mode {
+	case "closed":
+		log.Printf("  🔁 Closed loop with %d requests in flight for %s (+%s warm-up)", *concurrency, *duration, *warmup)
+		stats := runClosedLoop(ctx, config, *concurrency)
+		finishRun(stats, *hgrmDir, "")
+	case "open":
+		if *rate <= 0 {
+			log.Fatalf("❌ -rate must be positive")
+		}
+		log.Printf("  ⏩ Open loop at %.2f req/s for %s (+%s warm-up)", *rate, *duration, *warmup)
+		stats := runOpenLoop(ctx, config, *rate, *maxInFlight)
+		finishRun(stats, *hgrmDir, "")
+	case "sweep":
+		levels, err := parseLevels(*sweep)
+		if err != nil {
+			log.Fatalf("❌ %v", err)
+		}
+		var results []sweepLevel
+		for _, level := range levels {
+			if ctx.Err() != nil {
+				break
+			}
+			log.Printf("  🔁 Closed loop with %d requests in flight for %s (+%s warm-up)", level, *duration, *warmup)
+			stats := runClosedLoop(ctx, config, level)
+			finishRun(stats, *hgrmDir, fmt.Sprintf("c%d-", level))
+			results = append(results, sweepLevel{concurrency: level, stats: stats})
+		}
+		printSweepReport(os.Stdout, results)
+	default:
+		log.Fatalf("❌ Unknown mode %q (closed, open or sweep)", *mode)
+	}
+}
+
+// finishRun imprime el reporte de una corrida y, si se pidió, guarda sus histogramas
+func finishRun(stats *runStats, hgrmDir, prefix string) {
+	printRunReport(os.Stdout, stats)
+	if hgrmDir == "" {
+		return
+	}
+	if err := writeHistograms(hgrmDir, prefix, stats); err != nil {
+		log.Printf("⚠️  %v", err)
+	}
+}
+
+// parseLevels interpreta la lista de niveles de concurrencia del modo sweep
+func parseLevels(value string) ([]int, error) {
+	var levels []int
+	for _, part := range strings.Split(value, ",") {
+		level, err := strconv.Atoi(strings.TrimSpace(part))
+		if err != nil || level <= 0 {
+			return nil, fmt.Errorf("invalid concurrency level %q", part)
+		}
+		levels = append(levels, level)
+	}
+	return levels, nil
+}
@@ -0,0 +1,128 @@
+package main
+
+import (
+	"fmt"
+	"io"
+	"os"
+	"path/filepath"
+	"sort"
+	"text/tabwriter"
+	"time"
+)
+
+// reportPercentiles son los percentiles de la tabla de latencias
+var reportPercentiles = []float64{50, 90, 99, 99.9}
+
+// saturationGain es la mejora mínima de throughput entre dos niveles de concurrencia
+// para no considerar saturado al servicio
+const saturationGain = 0.05
+
+// printRunReport imprime las latencias por fase, los resultados por tipo de envío y el
+// throughput de una corrida
+func printRunReport(w io.Writer, stats *runStats) {
+	fmt.Fprintf(w, "\n📊 Latency by phase (ms)\n")
+	table := tabwriter.NewWriter(w, 0, 0, 2, ' ', tabwriter.AlignRight)
+	fmt.Fprintf(table, "phase\tcount\tmin\tmean\t")
+	for _, p := range reportPercentiles {
+		fmt.Fprintf(table, "p%g\t", p)
+	}
+	fmt.Fprintf(table, "max\t\n")
+	for _, phase := range phaseNames {
+		h := stats.histograms[phase]
+		if h.Count() == 0 {
+			continue
+		}
+		fmt.Fprintf(table, "%s\t%d\t%s\t%s\t", phase, h.Count(), millis(h.Min()), millis(h.Mean()))
+		for _, p := range reportPercentiles {
+			fmt.Fprintf(table, "%s\t", millis(h.ValueAtPercentile(p)))
+		}
+		fmt.Fprintf(table, "%s\t\n", millis(h.Max()))
+	}
+	table.Flush()
+
+	fmt.Fprintf(w, "\n🧪 Outcomes by submission kind\n")
+	table = tabwriter.NewWriter(w, 0, 0, 2, ' ', 0)
+	for _, kind := range sortedKeys(stats.outcomes) {
+		for _, outcome := range sortedKeys(stats.outcomes[kind]) {
+			fmt.Fprintf(table, "  %s\t%s\t%d\n", kind, outcome, stats.outcomes[kind][outcome])
+		}
+	}
+	table.Flush()
+
+	fmt.Fprintf(w, "\n⚡ Throughput: %.2f req/s (%d completed, %d rpc errors, %d dropped) over %s\n",
+		stats.throughput(), stats.completed, stats.errors, stats.dropped,
+		stats.finished.Sub(stats.measureFrom).Round(time.Millisecond))
+}
+
+// sweepLevel es el resultado de un nivel de concurrencia del barrido
+type sweepLevel struct {
+	concurrency int
+	stats       *runStats
+}
+
+// printSweepReport imprime el throughput y la latencia total por nivel de concurrencia y
+// el punto de saturación: el primer nivel que mejora el throughput del anterior en menos
+// de saturationGain
+func printSweepReport(w io.Writer, levels []sweepLevel) {
+	fmt.Fprintf(w, "\n📈 Throughput by concurrency\n")
+	table := tabwriter.NewWriter(w, 0, 0, 2, ' ', tabwriter.AlignRight)
+	fmt.Fprintf(table, "concurrency\treq/s\tp50 ms\tp99 ms\trpc errors\t\n")
+	for _, level := range levels {
+		total := level.stats.histograms["total"]
+		fmt.Fprintf(table, "%d\t%.2f\t%s\t%s\t%d\t\n", level.concurrency, level.stats.throughput(),
+			millis(total.ValueAtPercentile(50)), millis(total.ValueAtPercentile(99)), level.stats.errors)
+	}
+	table.Flush()
+
+	best := 0
+	for i := 1; i < len(levels); i++ {
+		previous, current := levels[i-1].stats.throughput(), levels[i].stats.throughput()
+		if current < previous*(1+saturationGain) {
+			break
+		}
+		best = i
+	}
+	if len(levels) > 0 {
+		fmt.Fprintf(w, "\n🔝 Saturation: %.2f req/s at concurrency %d\n", levels[best].stats.throughput(), levels[best].concurrency)
+	}
+}
+
+// writeHistograms guarda la distribución de cada fase en <dir>/<prefix><fase>.hgrm
+func writeHistograms(dir, prefix string, stats *runStats) error {
+	if err := os.MkdirAll(dir, 0755); err != nil {
+		return fmt.Errorf("failed to create histogram directory: %w", err)
+	}
+	for _, phase := range phaseNames {
+		h := stats.histograms[phase]
+		if h.Count() == 0 {
+			continue
+		}
+		file, err := os.Create(filepath.Join(dir, prefix+phase+".hgrm"))
+		if err != nil {
+			return fmt.Errorf("failed to create histogram file: %w", err)
+		}
+		err = h.WritePercentiles(file)
+		if closeErr := file.Close(); err == nil {
+			err = closeErr
+		}
+		if err != nil {
+			return fmt.Errorf("failed to write histogram: %w", err)
+		}
+	}
+	return nil
+}
+
+// millis formatea una duración en milisegundos con un decimal
+func millis(d time.Duration) string {
+	return fmt.Sprintf("%.1f", float64(d)/float64(time.Millisecond))
+}
+
+// sortedKeys retorna las claves de un mapa en orden
+func sortedKeys[V any](m map[string]V) []string {
+	keys := make([]string, 0, len(m))
+	for key := range m {
+		keys = append(keys, key)
+	}
+	sort.Strings(keys)
+	return keys
+}
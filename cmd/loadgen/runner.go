@@ -0,0 +1,288 @@
+package main
+
+import (
+	"context"
+	"io"
+	"math/rand"
+	"strings"
+	"sync"
+	"sync/atomic"
+	"time"
+
+	"google.golang.org/grpc/status"
+
+	pb "code-runner/api/gen/proto"
+)
+
+// Fases medidas por petición, en orden. Con EvaluateSolutionStream se separan a partir
+// de los eventos de avance; con la llamada unaria solo se mide total.
+//   - queue: desde el envío hasta que empieza la compilación (cola del scheduler y
+//     generación del template)
+//   - compile: compiling → compiled (ausente en un hit del cache de compilación)
+//   - run: running → done (tests, lectura de resultados y respuesta)
+//   - total: desde el envío (o el instante programado, en lazo abierto) hasta la respuesta
+var phaseNames = []string{"queue", "compile", "run", "total"}
+
+// closedLoopErrorBackoff es la pausa de un worker de lazo cerrado tras un error gRPC
+const closedLoopErrorBackoff = 100 * time.Millisecond
+
+// sample es la medición de una petición
+type sample struct {
+	kind      string
+	outcome   string
+	scheduled time.Time
+	phases    map[string]time.Duration
+}
+
+// runConfig son los parámetros de una corrida
+type runConfig struct {
+	client         pb.SolutionEvaluationServiceClient
+	picker         *picker
+	options        requestOptions
+	stream         bool
+	requestTimeout time.Duration
+	duration       time.Duration
+	warmup         time.Duration
+	seed           int64
+
+	sequence atomic.Int64 // Número de la próxima petición (para los comentarios únicos)
+}
+
+// runStats acumula las mediciones de una corrida
+type runStats struct {
+	mu         sync.Mutex
+	histograms map[string]*Histogram
+	outcomes   map[string]map[string]int // tipo de envío → resultado → cantidad
+	completed  int64
+	errors     int64 // Peticiones sin respuesta (errores gRPC, incluidos los rechazos)
+	dropped    int64 // Llegadas descartadas por superar max-inflight (lazo abierto)
+
+	measureFrom time.Time // Las peticiones programadas antes son de calentamiento
+	started     time.Time
+	finished    time.Time
+}
+
+// newRunStats crea los acumuladores de una corrida que empieza ahora
+func newRunStats(warmup time.Duration) *runStats {
+	now := time.Now()
+	stats := &runStats{
+		histograms:  make(map[string]*Histogram, len(phaseNames)),
+		outcomes:    make(map[string]map[string]int),
+		measureFrom: now.Add(warmup),
+		started:     now,
+	}
+	for _, phase := range phaseNames {
+		stats.histograms[phase] = NewHistogram()
+	}
+	return stats
+}
+
+// record agrega la medición de una petición (salvo las del calentamiento)
+func (s *runStats) record(m sample) {
+	if m.scheduled.Before(s.measureFrom) {
+		return
+	}
+
+	s.mu.Lock()
+	defer s.mu.Unlock()
+	if s.outcomes[m.kind] == nil {
+		s.outcomes[m.kind] = make(map[string]int)
+	}
+	s.outcomes[m.kind][m.outcome]++
+	if strings.HasPrefix(m.outcome, "rpc_") {
+		s.errors++
+		return
+	}
+	s.completed++
+	for phase, d := range m.phases {
+		s.histograms[phase].Record(d)
+	}
+}
+
+// throughput retorna las respuestas completas por segundo del período medido
+func (s *runStats) throughput() float64 {
+	elapsed := s.finished.Sub(s.measureFrom).Seconds()
+	if elapsed <= 0 {
+		return 0
+	}
+	return float64(s.completed) / elapsed
+}
+
+// evaluate envía un envío y mide sus fases desde scheduled
+func (c *runConfig) evaluate(ctx context.Context, submission *Submission, scheduled time.Time) sample {
+	m := sample{kind: submission.Kind, scheduled: scheduled, phases: make(map[string]time.Duration, len(phaseNames))}
+	req := buildRequest(submission, c.sequence.Add(1), c.options)
+
+	ctx, cancel := context.WithTimeout(ctx, c.requestTimeout)
+	defer cancel()
+
+	if !c.stream {
+		response, err := c.client.EvaluateSolution(ctx, req)
+		if err != nil {
+			m.outcome = rpcOutcome(err)
+			return m
+		}
+		m.phases["total"] = time.Since(scheduled)
+		m.outcome = responseOutcome(response)
+		return m
+	}
+
+	stream, err := c.client.EvaluateSolutionStream(ctx, req)
+	if err != nil {
+		m.outcome = rpcOutcome(err)
+		return m
+	}
+
+	var compiling, compiled, running time.Time
+	for {
+		event, err := stream.Recv()
+		if err == io.EOF {
+			m.outcome = "rpc_incomplete_stream"
+			return m
+		}
+		if err != nil {
+			m.outcome = rpcOutcome(err)
+			return m
+		}
+
+		now := time.Now()
+		switch event.GetPhase() {
+		case "compiling":
+			compiling = now
+		case "compiled":
+			compiled = now
+		case "running":
+			running = now
+		case "done":
+			queueEnd := compiling
+			if queueEnd.IsZero() {
+				// Compile cache hit: no compiling event
+				queueEnd = compiled
+			}
+			if !queueEnd.IsZero() {
+				m.phases["queue"] = queueEnd.Sub(scheduled)
+			}
+			if !compiling.IsZero() && !compiled.IsZero() {
+				m.phases["compile"] = compiled.Sub(compiling)
+			}
+			if !running.IsZero() {
+				m.phases["run"] = now.Sub(running)
+			}
+			m.phases["total"] = now.Sub(scheduled)
+			m.outcome = responseOutcome(event.GetResponse())
+			return m
+		}
+	}
+}
+
+// rpcOutcome clasifica una llamada fallida por su código gRPC (resource_exhausted es un
+// rechazo del control de admisión)
+func rpcOutcome(err error) string {
+	return "rpc_" + strings.ToLower(toSnakeCase(status.Code(err).String()))
+}
+
+// toSnakeCase convierte "ResourceExhausted" en "Resource_Exhausted"
+func toSnakeCase(s string) string {
+	var b strings.Builder
+	for i, r := range s {
+		if i > 0 && r >= 'A' && r <= 'Z' {
+			b.WriteByte('_')
+		}
+		b.WriteRune(r)
+	}
+	return b.String()
+}
+
+// responseOutcome clasifica una respuesta: passed, el error_type del servicio o failed
+func responseOutcome(response *pb.ExecutionResponse) string {
+	switch {
+	case response == nil:
+		return "rpc_empty_response"
+	case response.GetSuccess():
+		return "passed"
+	case response.GetErrorType() != "":
+		return response.GetErrorType()
+	default:
+		return "failed"
+	}
+}
+
+// runClosedLoop mantiene concurrency peticiones en vuelo: cada worker envía la siguiente
+// apenas recibe la respuesta anterior. Mide la latencia bajo una concurrencia fija y la
+// capacidad máxima del servicio.
+func runClosedLoop(ctx context.Context, c *runConfig, concurrency int) *runStats {
+	stats := newRunStats(c.warmup)
+	deadline := stats.started.Add(c.warmup + c.duration)
+
+	var wg sync.WaitGroup
+	for w := 0; w < concurrency; w++ {
+		wg.Add(1)
+		go func(worker int) {
+			defer wg.Done()
+			rng := rand.New(rand.NewSource(c.seed + int64(worker)))
+			for ctx.Err() == nil && time.Now().Before(deadline) {
+				m := c.evaluate(ctx, c.picker.pick(rng), time.Now())
+				stats.record(m)
+				if strings.HasPrefix(m.outcome, "rpc_") {
+					// A rejected request returns at once: back off instead of spinning
+					time.Sleep(closedLoopErrorBackoff)
+				}
+			}
+		}(w)
+	}
+	wg.Wait()
+
+	stats.finished = time.Now()
+	return stats
+}
+
+// runOpenLoop envía rate peticiones por segundo sin esperar las respuestas, como llegan
+// los envíos reales. La latencia se mide desde el instante programado de cada llegada, así
+// que un servicio lento no reduce la carga que recibe (sin omisión coordinada). Si hay
+// maxInFlight peticiones sin responder, las llegadas se descartan y se cuentan.
+func runOpenLoop(ctx context.Context, c *runConfig, rate float64, maxInFlight int) *runStats {
+	stats := newRunStats(c.warmup)
+	deadline := stats.started.Add(c.warmup + c.duration)
+	interval := time.Duration(float64(time.Second) / rate)
+	rng := rand.New(rand.NewSource(c.seed))
+	inFlight := make(chan struct{}, maxInFlight)
+
+	var wg sync.WaitGroup
+	for i := 0; ctx.Err() == nil; i++ {
+		scheduled := stats.started.Add(time.Duration(i) * interval)
+		if !scheduled.Before(deadline) {
+			break
+		}
+		if wait := time.Until(scheduled); wait > 0 {
+			timer := time.NewTimer(wait)
+			select {
+			case <-timer.C:
+			case <-ctx.Done():
+				timer.Stop()
+			}
+		}
+
+		submission := c.picker.pick(rng)
+		select {
+		case inFlight <- struct{}{}:
+		default:
+			if !scheduled.Before(stats.measureFrom) {
+				stats.mu.Lock()
+				stats.dropped++
+				stats.mu.Unlock()
+			}
+			continue
+		}
+
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			defer func() { <-inFlight }()
+			stats.record(c.evaluate(ctx, submission, scheduled))
+		}()
+	}
+	wg.Wait()
+
+	stats.finished = time.Now()
+	return stats
+}
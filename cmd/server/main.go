@@ -17,17 +17,27 @@ import (
 	"code-runner/internal/docker"
 	"code-runner/internal/kafka"
 	"code-runner/internal/server"
+	"code-runner/internal/tracing"
 	"code-runner/internal/utils"
 )
 
 func main() {
+	if err := run(); err != nil {
+		log.Fatalf("❌ %v", err)
+	}
+}
+
+// run arranca el servidor y retorna cuando se detiene. Los errores se retornan en lugar de
+// terminar el proceso para que los defers (en particular el cierre del executor, que
+// elimina los contenedores del pool) se ejecuten también cuando el arranque falla.
+func run() error {
 	config, err := env.LoadConfig()
 	if err != nil {
-		log.Fatalf("Failed to load configuration: %v", err)
+		return fmt.Errorf("failed to load configuration: %w", err)
 	}
 
 	if err := database.InitDB(&config.Database); err != nil {
-		log.Fatalf("Failed to initialize database: %v", err)
+		return fmt.Errorf("failed to initialize database: %w", err)
 	}
 	defer func() {
 		if err := database.Close(); err != nil {
@@ -35,6 +45,24 @@ func main() {
 		}
 	}()
 
+	shutdownTracing, err := tracing.Init(context.Background(), tracing.Config{
+		Exporter:     config.Tracing.Exporter,
+		OTLPEndpoint: config.Tracing.OTLPEndpoint,
+		OTLPInsecure: config.Tracing.OTLPInsecure,
+		SampleRatio:  config.Tracing.SampleRatio,
+		ServiceName:  config.App.Name,
+	})
+	if err != nil {
+		return fmt.Errorf("failed to initialize tracing: %w", err)
+	}
+	defer func() {
+		ctx, cancel := context.WithTimeout(context.Background(), 5*time.Second)
+		defer cancel()
+		if err := shutdownTracing(ctx); err != nil {
+			log.Printf("Error flushing traces: %v", err)
+		}
+	}()
+
 	log.Printf("📡 Initializing Kafka client...")
 	kafkaClient, err := kafka.NewKafkaClient(&config.Kafka)
 	if err != nil {
@@ -49,16 +77,50 @@ func main() {
 	}
 
 	log.Printf("🐳 Initializing Docker environment...")
-	dockerExecutor, err := docker.NewDockerExecutor()
+	dockerConfig := docker.DefaultDockerConfig()
+	dockerConfig.PoolSize = config.Executor.PoolSize
+	dockerConfig.PoolMaxUses = config.Executor.PoolMaxUses
+	dockerConfig.CompileCacheDir = config.Executor.CompileCacheDir
+	dockerConfig.CompileCacheMaxMB = config.Executor.CompileCacheMaxMB
+	dockerConfig.MaxOutputBytes = config.Executor.MaxOutputKB * 1024
+	dockerConfig.WorkspaceTmpfsMB = config.Executor.WorkspaceTmpfsMB
+	dockerConfig.MaxTestShards = config.Executor.MaxTestShards
+	dockerConfig.ForkPerTest = config.Executor.ForkPerTest
+	dockerConfig.TestTimeLimitMS = config.Executor.TestTimeLimitMS
+
+	dockerExecutor, err := docker.NewDockerExecutorWithConfig(dockerConfig)
 	if err != nil {
-		log.Fatalf("Failed to create Docker executor: %v", err)
+		return fmt.Errorf("failed to create Docker executor: %w", err)
 	}
+	defer func() {
+		if err := dockerExecutor.Close(); err != nil {
+			log.Printf("Error closing Docker executor: %v", err)
+		}
+	}()
 
 	ctx, cancel := context.WithTimeout(context.Background(), 10*time.Minute)
 	defer cancel()
 
 	if err := dockerExecutor.EnsureImagesReady(ctx); err != nil {
-		log.Fatalf("Failed to ensure Docker images are ready: %v", err)
+		return fmt.Errorf("failed to ensure Docker images are ready: %w", err)
+	}
+
+	if err := dockerExecutor.StartPool(ctx); err != nil {
+		return fmt.Errorf("failed to start container pool: %w", err)
+	}
+
+	// The native backend still compiles in Docker but runs binaries directly on the host
+	var executor docker.Executor = dockerExecutor
+	if config.Executor.Backend == "native" {
+		nativeConfig := docker.DefaultNativeConfig()
+		nativeConfig.WorkDir = config.Executor.NativeWorkDir
+		nativeConfig.CgroupRoot = config.Executor.NativeCgroupRoot
+
+		nativeExecutor, err := docker.NewNativeExecutor(dockerExecutor, nativeConfig)
+		if err != nil {
+			return fmt.Errorf("failed to create native executor: %w", err)
+		}
+		executor = nativeExecutor
 	}
 
 	grpcPort := os.Getenv("GRPC_PORT")
@@ -68,7 +130,7 @@ func main() {
 
 	portInt, err := strconv.Atoi(grpcPort)
 	if err != nil {
-		log.Fatalf("Invalid GRPC_PORT: %v", err)
+		return fmt.Errorf("invalid GRPC_PORT: %w", err)
 	}
 
 	if config.ServiceDiscovery.Enabled && config.ServiceDiscovery.URL != "" {
@@ -112,11 +174,31 @@ func main() {
 		log.Printf("🔍 Service Discovery: %s", config.ServiceDiscovery.URL)
 	}
 
-	if err := server.StartServer(grpcPort, database.GetDB(), kafkaClient); err != nil {
-		log.Fatalf("Failed to start server: %v", err)
+	executionSlots := config.Executor.Slots
+	if executionSlots <= 0 {
+		executionSlots = dockerExecutor.SuggestedSlots(ctx)
+	}
+
+	serverOptions := server.ServerOptions{
+		ResultCacheEnabled:  config.Server.ResultCacheEnabled,
+		ResultCacheTTL:      time.Duration(config.Server.ResultCacheTTLSeconds) * time.Second,
+		ExecutionSlots:      executionSlots,
+		QueueSize:           config.Executor.QueueSize,
+		BatchMaxSubmissions: config.Server.BatchMaxSubmissions,
+	}
+
+	go func() {
+		if err := server.StartHTTPServer(config.Server.Port); err != nil {
+			log.Printf("❌ HTTP server stopped: %v", err)
+		}
+	}()
+
+	if err := server.StartServer(grpcPort, database.GetDB(), kafkaClient, executor, serverOptions); err != nil {
+		return fmt.Errorf("failed to start server: %w", err)
 	}
 
 	log.Println("Server stopped")
+	return nil
 }
 
 func registerWithEureka(eurekaURL, publicIP string, port int, serviceName string, instanceID string, ipAddress string) {
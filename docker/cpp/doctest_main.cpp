@@ -0,0 +1,498 @@
+// Implementación de doctest y main() compartidos por todas las ejecuciones.
+// Se compila una sola vez al construir la imagen coderunner-cpp; cada envío
+// solo compila su propio código y los TEST_CASE generados, y enlaza libcoderunner_doctest.a.
+//
+// Además registra un listener que mide cada TEST_CASE (tiempo y reservas de memoria).
+// Si el executor pasa un descriptor en CODERUNNER_REPORT_FD, el listener escribe ahí un
+// reporte JSON Lines (un objeto por evento) que DoctestParser decodifica sin depender del
+// stdout de la solución:
+//
+//   {"event":"case_start","name":"<test>"}
+//   {"event":"assert","name":"<test>","message":"<CHECK fallido>"}
+//   {"event":"exception","name":"<test>","message":"<excepción o señal>","crash":false}
+//   {"event":"case_end","name":"<test>","passed":true,"duration_ns":<ns>,"allocations":<n>}
+//   {"event":"run_end","total":<n>,"failed":<n>,"aborted":false}
+//
+// aborted indica que --abort-after (modo fail-fast) detuvo la corrida: los tests que faltan
+// no se ejecutaron y total solo cuenta los alcanzados.
+//
+// La solución corre en este mismo proceso, así que puede falsificar el reporte: cualquier
+// descriptor en el que el listener escribe también lo puede escribir ella (por ejemplo, un
+// run_end limpio seguido de _exit(0)). El harness solo lo dificulta: mueve el descriptor
+// fuera del fd 3 y lo oculta antes de que corra la solución, y el executor descarta un
+// reporte sin run_end, o con un run_end limpio cuando el proceso no salió con 0.
+//
+// Además, siempre imprime en stdout una línea por test apenas termina, que el executor lee
+// mientras la solución corre para reportar el avance (y que el parser de stdout usa cuando
+// no hay reporte):
+//
+//   [coderunner] test-timing passed=<0|1> duration_ns=<ns> allocations=<n> name=<nombre del TEST_CASE>
+//
+// Con --coderunner-fork-tests, main() inicializa el programa una sola vez y ejecuta cada
+// TEST_CASE en un proceso hijo (fork). Un crash solo se lleva su test: los siguientes se
+// ejecutan igual. Tras cada hijo, el padre agrega al reporte cómo terminó, que corresponde
+// al último case_start, y escribe el único run_end:
+//
+//   {"event":"process_end","exit_code":<n>,"signal":<n>,"timed_out":false,"peak_rss_kb":<kb>,"user_ms":<ms>,"sys_ms":<ms>,"wall_ms":<ms>}
+//
+// --coderunner-test-timeout-ms=<ms> da a cada TEST_CASE un presupuesto de tiempo real e
+// implica el modo fork: si el hijo no termina a tiempo, el padre lo mata (con su grupo de
+// procesos), su process_end lleva "timed_out":true y la corrida sigue con el siguiente test.
+#define DOCTEST_CONFIG_IMPLEMENT
+#include "doctest.h"
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/auxv.h>
+#include <sys/resource.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <new>
+#include <ostream>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+// Reservas hechas con operator new (contenedores de la STL, new explícito...)
+std::atomic<long long> g_allocations{0};
+
+// Este proceso es un hijo del modo fork: el run_end lo escribe el padre
+bool g_forkChild = false;
+
+// En un hijo del modo fork, pipe por el que informa al padre cuántas aserciones fallaron
+int g_forkAssertsFD = -1;
+
+// Resultado de la consulta --count del modo fork: tests que pasan los filtros y las
+// opciones de la línea de comandos que el padre aplica por su cuenta
+struct ForkQuery {
+    unsigned total = 0;
+    unsigned first = 0;
+    unsigned last = 0;
+    int abortAfter = 0;
+} g_forkQuery;
+
+}  // namespace
+
+// Reemplazo global de operator new que solo cuenta las reservas. Las variantes nothrow
+// y de arrays de libstdc++ delegan en esta, y el operator delete por defecto usa free().
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (size == 0) {
+        size = 1;
+    }
+    while (true) {
+        if (void* ptr = std::malloc(size)) {
+            return ptr;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+// Opciones de AddressSanitizer para los perfiles con sanitizers (sin efecto en el resto):
+//  - detect_leaks=0: LeakSanitizer necesita ptrace, que el sandbox no permite
+//  - alloc_dealloc_mismatch=0: el operator new de arriba reserva con malloc()
+extern "C" const char* __asan_default_options() {
+    return "detect_leaks=0:alloc_dealloc_mismatch=0";
+}
+
+namespace {
+
+// reportFD lee CODERUNNER_REPORT_FD una sola vez y lo oculta: borra la variable y mueve
+// el descriptor a un número al azar (close-on-exec, así un programa que la solución lance
+// con exec no lo hereda), cerrando el original. Un write(3, ...) de la solución ya no llega
+// al reporte, aunque todavía podría encontrarlo en /proc/self/fd. Retorna -1 si el
+// executor no pasó un descriptor.
+int reportFD() {
+    static const int fd = [] {
+        const char* value = std::getenv("CODERUNNER_REPORT_FD");
+        if (value == nullptr || *value == '\0') {
+            return -1;
+        }
+        int parsed = std::atoi(value);
+        unsetenv("CODERUNNER_REPORT_FD");
+
+        // AT_RANDOM: 16 random bytes the kernel gives every process
+        unsigned offset = 0;
+        if (const unsigned char* random = reinterpret_cast<const unsigned char*>(getauxval(AT_RANDOM))) {
+            offset = (random[0] | random[1] << 8) % 768;
+        }
+        int moved = fcntl(parsed, F_DUPFD_CLOEXEC, 256 + static_cast<int>(offset));
+        if (moved < 0) {
+            fcntl(parsed, F_SETFD, FD_CLOEXEC);
+            return parsed;
+        }
+        close(parsed);
+        return moved;
+    }();
+    return fd;
+}
+
+// Corre antes que los inicializadores estáticos de la solución (prioridad por defecto),
+// que ya no encuentran CODERUNNER_REPORT_FD en el entorno
+__attribute__((constructor(101))) void hideReportFD() {
+    reportFD();
+}
+
+// openReport abre el descriptor del reporte indicado por CODERUNNER_REPORT_FD.
+// Usa stdio (malloc) para no sumar reservas de operator new a los tests.
+FILE* openReport() {
+    int fd = reportFD();
+    if (fd < 0) {
+        return nullptr;
+    }
+    return fdopen(fd, "w");
+}
+
+// writeJSONChars escribe s escapado para ir dentro de un string JSON
+void writeJSONChars(FILE* out, const char* s) {
+    for (; *s != '\0'; ++s) {
+        unsigned char c = static_cast<unsigned char>(*s);
+        switch (c) {
+            case '"': std::fputs("\\\"", out); break;
+            case '\\': std::fputs("\\\\", out); break;
+            case '\n': std::fputs("\\n", out); break;
+            case '\r': std::fputs("\\r", out); break;
+            case '\t': std::fputs("\\t", out); break;
+            default:
+                if (c < 0x20) {
+                    std::fprintf(out, "\\u%04x", c);
+                } else {
+                    std::fputc(c, out);
+                }
+        }
+    }
+}
+
+// writeJSONString escribe s como string JSON
+void writeJSONString(FILE* out, const char* s) {
+    std::fputc('"', out);
+    writeJSONChars(out, s);
+    std::fputc('"', out);
+}
+
+struct CodeRunnerListener : public doctest::IReporter {
+    const doctest::ContextOptions& options;
+    std::ostream& out;
+    FILE* report;
+    int abortAfter;
+    const char* name = "";
+    std::chrono::steady_clock::time_point start;
+    long long allocationsAtStart = 0;
+
+    explicit CodeRunnerListener(const doctest::ContextOptions& opts)
+        : options(opts), out(*opts.cout), report(openReport()), abortAfter(opts.abort_after) {}
+
+    // beginEvent escribe el inicio de un objeto con el evento y el test actual
+    void beginEvent(const char* event) {
+        std::fprintf(report, "{\"event\":\"%s\",\"name\":", event);
+        writeJSONString(report, name);
+    }
+
+    // endEvent cierra el objeto; el flush conserva el reporte si la solución crashea
+    void endEvent() {
+        std::fputs("}\n", report);
+        std::fflush(report);
+    }
+
+    void test_case_start(const doctest::TestCaseData& tc) override {
+        name = tc.m_name;
+        if (report != nullptr) {
+            beginEvent("case_start");
+            endEvent();
+        }
+        allocationsAtStart = g_allocations.load(std::memory_order_relaxed);
+        start = std::chrono::steady_clock::now();
+    }
+
+    void test_case_end(const doctest::CurrentTestCaseStats& stats) override {
+        long long durationNS = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   std::chrono::steady_clock::now() - start)
+                                   .count();
+        long long allocations = g_allocations.load(std::memory_order_relaxed) - allocationsAtStart;
+
+        // std::endl flushes so the executor sees the line while later tests still run
+        out << "[coderunner] test-timing passed=" << (stats.testCaseSuccess ? 1 : 0)
+            << " duration_ns=" << durationNS << " allocations=" << allocations
+            << " name=" << name << std::endl;
+
+        if (report == nullptr) {
+            return;
+        }
+        beginEvent("case_end");
+        std::fprintf(report, ",\"passed\":%s,\"duration_ns\":%lld,\"allocations\":%lld",
+                     stats.testCaseSuccess ? "true" : "false", durationNS, allocations);
+        endEvent();
+    }
+
+    void log_assert(const doctest::AssertData& data) override {
+        if (report == nullptr || !data.m_failed) {
+            return;
+        }
+        // Same wording as the console reporter
+        const char* macro = doctest::assertString(data.m_at);
+        char lineBuffer[16];
+        std::snprintf(lineBuffer, sizeof(lineBuffer), "%d", data.m_line);
+        const char* line = lineBuffer;
+
+        beginEvent("assert");
+        std::fputs(",\"message\":\"", report);
+        for (const char* part : {data.m_file, ":", line, ": ERROR: ", macro, "( ", data.m_expr, " ) "}) {
+            writeJSONChars(report, part);
+        }
+        if (data.m_threw) {
+            writeJSONChars(report, "THREW exception: ");
+            writeJSONChars(report, data.m_exception.c_str());
+        } else {
+            for (const char* part : {"is NOT correct!\n  values: ", macro, "( ", data.m_decomp.c_str(), " )"}) {
+                writeJSONChars(report, part);
+            }
+        }
+        std::fputc('"', report);
+        endEvent();
+    }
+
+    void test_case_exception(const doctest::TestCaseException& e) override {
+        if (report == nullptr) {
+            return;
+        }
+        beginEvent("exception");
+        std::fputs(",\"message\":", report);
+        writeJSONString(report, e.error_string.c_str());
+        std::fprintf(report, ",\"crash\":%s", e.is_crash ? "true" : "false");
+        endEvent();
+    }
+
+    void test_run_end(const doctest::TestRunStats& stats) override {
+        if (g_forkChild) {
+            int failedAsserts = stats.numAssertsFailed;
+            ssize_t written = write(g_forkAssertsFD, &failedAsserts, sizeof(failedAsserts));
+            (void)written;
+            return;
+        }
+        if (report == nullptr) {
+            return;
+        }
+        bool aborted = abortAfter > 0 && stats.numAssertsFailed >= abortAfter;
+        std::fprintf(report, "{\"event\":\"run_end\",\"total\":%u,\"failed\":%u,\"aborted\":%s",
+                     static_cast<unsigned>(stats.numTestCasesPassingFilters),
+                     static_cast<unsigned>(stats.numTestCasesFailed), aborted ? "true" : "false");
+        endEvent();
+    }
+
+    // Solo la consulta --count del modo fork llega aquí
+    void report_query(const doctest::QueryData& data) override {
+        if (data.run_stats == nullptr) {
+            return;
+        }
+        g_forkQuery.total = data.run_stats->numTestCasesPassingFilters;
+        g_forkQuery.first = options.first;
+        g_forkQuery.last = options.last;
+        g_forkQuery.abortAfter = abortAfter;
+    }
+    void test_run_start() override {}
+    void test_case_reenter(const doctest::TestCaseData&) override {}
+    void subcase_start(const doctest::SubcaseSignature&) override {}
+    void subcase_end() override {}
+    void log_message(const doctest::MessageData&) override {}
+    void test_case_skipped(const doctest::TestCaseData&) override {}
+};
+
+}  // namespace
+
+DOCTEST_REGISTER_LISTENER("coderunner", 1, CodeRunnerListener);
+
+namespace {
+
+// timespecMS convierte un intervalo a milisegundos
+long long timespecMS(const timespec& start, const timespec& end) {
+    return (end.tv_sec - start.tv_sec) * 1000LL + (end.tv_nsec - start.tv_nsec) / 1000000LL;
+}
+
+// timevalMS convierte un tiempo de rusage a milisegundos
+long long timevalMS(const timeval& tv) {
+    return tv.tv_sec * 1000LL + tv.tv_usec / 1000LL;
+}
+
+// waitTest espera al hijo de un test y retorna true si lo mató por superar timeoutMS
+// (0 = sin límite). SIGCHLD está bloqueado en el padre, así que sigtimedwait despierta
+// apenas termina el hijo sin perder la señal si llegó antes.
+bool waitTest(pid_t pid, long long timeoutMS, const timespec& start, int& status, rusage& usage) {
+    bool timedOut = false;
+    if (timeoutMS > 0) {
+        sigset_t chld;
+        sigemptyset(&chld);
+        sigaddset(&chld, SIGCHLD);
+        while (wait4(pid, &status, WNOHANG, &usage) == 0) {
+            timespec now;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            long long left = timeoutMS - timespecMS(start, now);
+            if (left <= 0) {
+                // The test may have forked: kill its whole process group
+                kill(-pid, SIGKILL);
+                kill(pid, SIGKILL);
+                timedOut = true;
+                break;
+            }
+            timespec wait{static_cast<time_t>(left / 1000), static_cast<long>(left % 1000) * 1000000L};
+            sigtimedwait(&chld, nullptr, &wait);
+        }
+        if (!timedOut) {
+            return false;
+        }
+    }
+
+    while (wait4(pid, &status, 0, &usage) < 0 && errno == EINTR) {
+    }
+    return timedOut;
+}
+
+// runForked ejecuta cada TEST_CASE que pasa los filtros (y el rango --first/--last) en
+// un hijo con fork, de a uno, y reporta cómo terminó cada uno. Con timeoutMS > 0, un hijo
+// que supera ese tiempo se mata y cuenta como fallido. --abort-after cuenta aserciones
+// fallidas, como doctest sin fork: cada hijo recibe lo que queda del límite y le informa
+// al padre por un pipe cuántas fallaron; un test que crashea, hace timeout o sale sin
+// terminar su corrida cuenta como una. Sale con 0 si todos los tests pasaron.
+int runForked(int argc, char** argv, long long timeoutMS) {
+    // Count the tests without running them; the listener records the options
+    std::ostringstream discard;
+    doctest::Context counter(argc, argv);
+    counter.setOption("count", true);
+    counter.setCout(&discard);
+    counter.run();
+
+    unsigned first = std::max(g_forkQuery.first, 1u);
+    unsigned last = std::min(g_forkQuery.last, g_forkQuery.total);
+    FILE* report = openReport();
+    unsigned failed = 0;
+    int failedAsserts = 0;
+    bool aborted = false;
+
+    // Children exits are waited for with sigtimedwait; each child restores the mask
+    sigset_t chld, previousMask;
+    sigemptyset(&chld);
+    sigaddset(&chld, SIGCHLD);
+    sigprocmask(SIG_BLOCK, &chld, &previousMask);
+
+    for (unsigned k = first; k <= last; ++k) {
+        // Anything still buffered would be printed again by the child
+        std::cout.flush();
+        std::fflush(nullptr);
+
+        // Non-blocking: a process the test left behind may still hold the write end
+        int assertsPipe[2];
+        if (pipe2(assertsPipe, O_CLOEXEC | O_NONBLOCK) < 0) {
+            std::perror("coderunner: pipe");
+            return 125;
+        }
+
+        timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        pid_t pid = fork();
+        if (pid < 0) {
+            std::perror("coderunner: fork");
+            return 125;
+        }
+        if (pid == 0) {
+            g_forkChild = true;
+            g_forkAssertsFD = assertsPipe[1];
+            close(assertsPipe[0]);
+            setpgid(0, 0);
+            sigprocmask(SIG_SETMASK, &previousMask, nullptr);
+            doctest::Context child(argc, argv);
+            child.setOption("order-by", "file");
+            child.setOption("first", static_cast<int>(k));
+            child.setOption("last", static_cast<int>(k));
+            child.setOption("no-version", k != first);
+            if (g_forkQuery.abortAfter > 0) {
+                child.setOption("abort-after", g_forkQuery.abortAfter - failedAsserts);
+            }
+            int result = child.run();
+            // _exit: static destructors run once, in the parent
+            std::cout.flush();
+            std::fflush(nullptr);
+            _exit(result);
+        }
+
+        // Also set here so the group exists before the parent may need to kill it
+        setpgid(pid, pid);
+        close(assertsPipe[1]);
+
+        int status = 0;
+        rusage usage{};
+        bool timedOut = waitTest(pid, timeoutMS, start, status, usage);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        int childAsserts = 0;
+        if (read(assertsPipe[0], &childAsserts, sizeof(childAsserts)) != sizeof(childAsserts) || childAsserts < 0) {
+            childAsserts = 0;
+        }
+        close(assertsPipe[0]);
+
+        bool passed = !timedOut && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+        if (report != nullptr) {
+            std::fprintf(report,
+                         "{\"event\":\"process_end\",\"exit_code\":%d,\"signal\":%d,\"timed_out\":%s,"
+                         "\"peak_rss_kb\":%ld,\"user_ms\":%lld,\"sys_ms\":%lld,\"wall_ms\":%lld}\n",
+                         WIFEXITED(status) ? WEXITSTATUS(status) : 0, WIFSIGNALED(status) ? WTERMSIG(status) : 0,
+                         timedOut ? "true" : "false", usage.ru_maxrss, timevalMS(usage.ru_utime),
+                         timevalMS(usage.ru_stime), timespecMS(start, end));
+            std::fflush(report);
+        }
+
+        if (!passed) {
+            ++failed;
+            failedAsserts += std::max(childAsserts, 1);
+            if (g_forkQuery.abortAfter > 0 && failedAsserts >= g_forkQuery.abortAfter) {
+                aborted = k < last;
+                break;
+            }
+        }
+    }
+
+    if (report != nullptr) {
+        std::fprintf(report, "{\"event\":\"run_end\",\"total\":%u,\"failed\":%u,\"aborted\":%s}\n",
+                     g_forkQuery.total, failed, aborted ? "true" : "false");
+        std::fclose(report);
+    }
+    return failed == 0 ? 0 : 1;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    // --coderunner-* options are ours; doctest never sees them
+    static const char timeoutOption[] = "--coderunner-test-timeout-ms=";
+    std::vector<char*> args;
+    bool forked = false;
+    long long timeoutMS = 0;
+    for (int i = 0; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--coderunner-fork-tests") == 0) {
+            forked = true;
+        } else if (std::strncmp(argv[i], timeoutOption, sizeof(timeoutOption) - 1) == 0) {
+            forked = true;
+            timeoutMS = std::atoll(argv[i] + sizeof(timeoutOption) - 1);
+        } else {
+            args.push_back(argv[i]);
+        }
+    }
+
+    if (forked) {
+        return runForked(static_cast<int>(args.size()), args.data(), timeoutMS);
+    }
+    return doctest::Context(argc, argv).run();
+}
@@ -0,0 +1,117 @@
+/*
+ * measure: ejecuta la solución como el usuario coderunner y registra su consumo.
+ *
+ * Uso: measure <archivo-stats> <archivo-reporte> <programa> [args...]
+ *
+ * Corre como root (docker exec --user root), baja a UID/GID 1000 en el hijo y le pasa
+ * <archivo-reporte> abierto en el fd 3 (CODERUNNER_REPORT_FD=3) para el reporte de tests
+ * del harness; el usuario coderunner no puede abrirlo por su ruta. Al terminar, escribe
+ * en <archivo-stats>:
+ *
+ *   peak_rss_kb=<pico de memoria residente en KB>
+ *   user_ms=<tiempo de CPU en modo usuario>
+ *   sys_ms=<tiempo de CPU en modo kernel>
+ *   wall_ms=<tiempo real>
+ *
+ * Sale con el exit code del programa, o 128+señal si murió por una señal. El executor
+ * contrasta ese exit code con el run_end del reporte, que el programa sí puede escribir.
+ */
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <grp.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#define CODERUNNER_UID 1000
+#define CODERUNNER_GID 1000
+#define REPORT_FD 3
+
+static long long elapsed_ms(const struct timespec *start, const struct timespec *end) {
+    return (end->tv_sec - start->tv_sec) * 1000LL + (end->tv_nsec - start->tv_nsec) / 1000000LL;
+}
+
+static long long timeval_ms(const struct timeval *tv) {
+    return tv->tv_sec * 1000LL + tv->tv_usec / 1000LL;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 4) {
+        fprintf(stderr, "usage: %s <stats-file> <report-file> <program> [args...]\n", argv[0]);
+        return 125;
+    }
+    const char *stats_path = argv[1];
+    const char *report_path = argv[2];
+
+    /* Never report stats or results from a previous execution */
+    unlink(stats_path);
+    unlink(report_path);
+    int report_fd = open(report_path, O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW | O_CLOEXEC, 0600);
+    if (report_fd < 0) {
+        perror("measure: open report");
+        return 125;
+    }
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("measure: fork");
+        return 125;
+    }
+
+    if (pid == 0) {
+        if (setgroups(0, NULL) != 0 || setgid(CODERUNNER_GID) != 0 || setuid(CODERUNNER_UID) != 0) {
+            perror("measure: drop privileges");
+            _exit(125);
+        }
+        /* dup2 clears close-on-exec on the new descriptor */
+        if (report_fd == REPORT_FD ? fcntl(REPORT_FD, F_SETFD, 0) != 0 : dup2(report_fd, REPORT_FD) < 0) {
+            perror("measure: report fd");
+            _exit(125);
+        }
+        setenv("HOME", "/home/coderunner", 1);
+        setenv("USER", "coderunner", 1);
+        setenv("CODERUNNER_REPORT_FD", "3", 1);
+        execv(argv[3], &argv[3]);
+        perror("measure: exec");
+        _exit(127);
+    }
+
+    close(report_fd);
+
+    /* Let the child receive terminal signals, not the measuring process */
+    signal(SIGINT, SIG_IGN);
+    signal(SIGTERM, SIG_IGN);
+
+    int status;
+    struct rusage usage;
+    while (wait4(pid, &status, 0, &usage) < 0) {
+        if (errno != EINTR) {
+            perror("measure: wait4");
+            return 125;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    int fd = open(stats_path, O_WRONLY | O_CREAT | O_TRUNC | O_NOFOLLOW | O_CLOEXEC, 0600);
+    if (fd >= 0) {
+        dprintf(fd, "peak_rss_kb=%ld\nuser_ms=%lld\nsys_ms=%lld\nwall_ms=%lld\n",
+                usage.ru_maxrss, timeval_ms(&usage.ru_utime), timeval_ms(&usage.ru_stime),
+                elapsed_ms(&start, &end));
+        close(fd);
+    }
+
+    if (WIFSIGNALED(status)) {
+        return 128 + WTERMSIG(status);
+    }
+    return WEXITSTATUS(status);
+}
@@ -10,6 +10,8 @@ type Config struct {
 	Logging          LoggingConfig          `mapstructure:",squash"`
 	Kafka            KafkaConfig            `mapstructure:",squash"`
 	ServiceDiscovery ServiceDiscoveryConfig `mapstructure:",squash"`
+	Executor         ExecutorConfig         `mapstructure:",squash"`
+	Tracing          TracingConfig          `mapstructure:",squash"`
 }
 
 // AppConfig holds application configuration
@@ -20,8 +22,11 @@ type AppConfig struct {
 
 // ServerConfig holds server configuration
 type ServerConfig struct {
-	Port     string `mapstructure:"PORT"`
-	GRPCPort string `mapstructure:"GRPC_PORT"`
+	Port                  string `mapstructure:"PORT"`
+	GRPCPort              string `mapstructure:"GRPC_PORT"`
+	ResultCacheEnabled    bool   `mapstructure:"RESULT_CACHE_ENABLED"`
+	ResultCacheTTLSeconds int    `mapstructure:"RESULT_CACHE_TTL_SECONDS"`
+	BatchMaxSubmissions   int    `mapstructure:"BATCH_MAX_SUBMISSIONS"`
 }
 
 // DatabaseConfig holds database configuration
@@ -66,3 +71,29 @@ type ServiceDiscoveryConfig struct {
 	ServiceName string `mapstructure:"SERVICE_NAME"`
 	Hostname    string `mapstructure:"HOSTNAME"`
 }
+
+// ExecutorConfig holds code execution (Docker sandbox) configuration
+type ExecutorConfig struct {
+	PoolSize          int    `mapstructure:"EXECUTOR_POOL_SIZE"`
+	PoolMaxUses       int    `mapstructure:"EXECUTOR_POOL_MAX_USES"`
+	CompileCacheDir   string `mapstructure:"COMPILE_CACHE_DIR"`
+	CompileCacheMaxMB int64  `mapstructure:"COMPILE_CACHE_MAX_MB"`
+	MaxOutputKB       int64  `mapstructure:"EXECUTOR_MAX_OUTPUT_KB"`
+	WorkspaceTmpfsMB  int64  `mapstructure:"EXECUTOR_WORKSPACE_TMPFS_MB"`
+	MaxTestShards     int    `mapstructure:"EXECUTOR_MAX_TEST_SHARDS"`
+	ForkPerTest       bool   `mapstructure:"EXECUTOR_FORK_PER_TEST"`
+	TestTimeLimitMS   int64  `mapstructure:"EXECUTOR_TEST_TIME_LIMIT_MS"`
+	Slots             int    `mapstructure:"EXECUTOR_SLOTS"`
+	QueueSize         int    `mapstructure:"EXECUTOR_QUEUE_SIZE"`
+	Backend           string `mapstructure:"EXECUTOR_BACKEND"` // docker | native
+	NativeWorkDir     string `mapstructure:"NATIVE_WORK_DIR"`
+	NativeCgroupRoot  string `mapstructure:"NATIVE_CGROUP_ROOT"`
+}
+
+// TracingConfig holds OpenTelemetry tracing configuration
+type TracingConfig struct {
+	Exporter     string  `mapstructure:"TRACING_EXPORTER"` // none | otlp
+	OTLPEndpoint string  `mapstructure:"TRACING_OTLP_ENDPOINT"`
+	OTLPInsecure bool    `mapstructure:"TRACING_OTLP_INSECURE"`
+	SampleRatio  float64 `mapstructure:"TRACING_SAMPLE_RATIO"`
+}
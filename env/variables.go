@@ -22,8 +22,11 @@ func LoadConfig() (*Config, error) {
 			Version: getEnv("API_VERSION", "v1"),
 		},
 		Server: ServerConfig{
-			Port:     getEnv("PORT", "8084"),
-			GRPCPort: getEnv("GRPC_PORT", "9084"),
+			Port:                  getEnv("PORT", "8084"),
+			GRPCPort:              getEnv("GRPC_PORT", "9084"),
+			ResultCacheEnabled:    getEnvBool("RESULT_CACHE_ENABLED", false),
+			ResultCacheTTLSeconds: getEnvInt("RESULT_CACHE_TTL_SECONDS", 60),
+			BatchMaxSubmissions:   getEnvInt("BATCH_MAX_SUBMISSIONS", 5000),
 		},
 		Database: DatabaseConfig{
 			Host:            getEnv("DB_HOST", "localhost"),
@@ -59,6 +62,28 @@ func LoadConfig() (*Config, error) {
 			PublicIP:    getEnv("SERVICE_PUBLIC_IP", ""),
 			ServiceName: getEnv("SERVICE_NAME", "CODE-RUNNER-SERVICE"),
 		},
+		Executor: ExecutorConfig{
+			PoolSize:          getEnvInt("EXECUTOR_POOL_SIZE", 4),
+			PoolMaxUses:       getEnvInt("EXECUTOR_POOL_MAX_USES", 50),
+			CompileCacheDir:   getEnv("COMPILE_CACHE_DIR", "./compile_cache"),
+			CompileCacheMaxMB: int64(getEnvInt("COMPILE_CACHE_MAX_MB", 512)),
+			MaxOutputKB:       int64(getEnvInt("EXECUTOR_MAX_OUTPUT_KB", 1024)),
+			WorkspaceTmpfsMB:  int64(getEnvInt("EXECUTOR_WORKSPACE_TMPFS_MB", 64)),
+			MaxTestShards:     getEnvInt("EXECUTOR_MAX_TEST_SHARDS", 1),
+			ForkPerTest:       getEnvBool("EXECUTOR_FORK_PER_TEST", false),
+			TestTimeLimitMS:   int64(getEnvInt("EXECUTOR_TEST_TIME_LIMIT_MS", 0)),
+			Slots:             getEnvInt("EXECUTOR_SLOTS", 0), // 0 = derived from Docker host cores/memory
+			QueueSize:         getEnvInt("EXECUTOR_QUEUE_SIZE", 32),
+			Backend:           getEnv("EXECUTOR_BACKEND", "docker"),
+			NativeWorkDir:     getEnv("NATIVE_WORK_DIR", "/var/lib/coderunner/native"),
+			NativeCgroupRoot:  getEnv("NATIVE_CGROUP_ROOT", "/sys/fs/cgroup/coderunner"),
+		},
+		Tracing: TracingConfig{
+			Exporter:     getEnv("TRACING_EXPORTER", "none"),
+			OTLPEndpoint: getEnv("TRACING_OTLP_ENDPOINT", "localhost:4318"),
+			OTLPInsecure: getEnvBool("TRACING_OTLP_INSECURE", true),
+			SampleRatio:  getEnvFloat("TRACING_SAMPLE_RATIO", 1.0),
+		},
 	}
 
 	// Auto-enable service discovery if URL is provided
@@ -96,3 +121,13 @@ func getEnvBool(key string, fallback bool) bool {
 	}
 	return fallback
 }
+
+// getEnvFloat gets an environment variable as float64 with a fallback value
+func getEnvFloat(key string, fallback float64) float64 {
+	if value := os.Getenv(key); value != "" {
+		if val, err := strconv.ParseFloat(value, 64); err == nil {
+			return val
+		}
+	}
+	return fallback
+}
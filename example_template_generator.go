@@ -199,7 +199,9 @@ func (g *CppTemplateGenerator) hasCustomValidation(tests []*types.TestCase) bool
 // buildTemplate construye el template completo
 func (g *CppTemplateGenerator) buildTemplate(solutionCode, testCode string) string {
 	template := `// Start Test
-#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include <cstring>
+
 // Solution - Start
 %s
 // Solution - End
@@ -18,6 +18,12 @@ type GeneratedTestCode struct {
 	GeneratorType string `gorm:"type:varchar(50);not null;index" json:"generator_type"`
 	TestCode      string `gorm:"type:text;not null" json:"test_code"`
 
+	// Separate translation units for incremental compilation (not persisted; empty when
+	// the tests need the single template in TestCode)
+	SolutionUnit string `gorm:"-" json:"-"`
+	Declarations string `gorm:"-" json:"-"`
+	TestUnit     string `gorm:"-" json:"-"`
+
 	// Metadata
 	ChallengeID         string `gorm:"type:varchar(255);index" json:"challenge_id"`
 	TestCasesCount      int    `gorm:"type:integer;default:0" json:"test_cases_count"`
@@ -0,0 +1,219 @@
+package docker
+
+import (
+	"container/list"
+	"crypto/sha256"
+	"encoding/hex"
+	"fmt"
+	"log"
+	"os"
+	"path/filepath"
+	"sort"
+	"sync"
+	"sync/atomic"
+)
+
+// CompileCache guarda en disco los binarios compilados, indexados por el hash del
+// código fuente, los flags de compilación y la imagen usada. Es un LRU acotado por tamaño.
+type CompileCache struct {
+	dir      string
+	maxBytes int64
+
+	mu         sync.Mutex
+	entries    map[string]*list.Element
+	lru        *list.List // frente = usado más recientemente
+	totalBytes int64
+
+	hits   atomic.Int64
+	misses atomic.Int64
+}
+
+// compileCacheEntry representa un binario almacenado en el cache
+type compileCacheEntry struct {
+	key  string
+	size int64
+}
+
+// NewCompileCache crea (o reabre) un cache de compilación en dir con un tamaño máximo en bytes
+func NewCompileCache(dir string, maxBytes int64) (*CompileCache, error) {
+	if err := os.MkdirAll(dir, 0755); err != nil {
+		return nil, fmt.Errorf("failed to create compile cache directory: %w", err)
+	}
+
+	cache := &CompileCache{
+		dir:      dir,
+		maxBytes: maxBytes,
+		entries:  make(map[string]*list.Element),
+		lru:      list.New(),
+	}
+
+	if err := cache.load(); err != nil {
+		return nil, err
+	}
+
+	log.Printf("🗃️  Compile cache ready at %s (%d entries, %.1f MB / %.1f MB)",
+		dir, cache.lru.Len(), float64(cache.totalBytes)/(1024*1024), float64(maxBytes)/(1024*1024))
+	return cache, nil
+}
+
+// CompileCacheKey calcula la clave del cache para un código fuente, comando de
+// compilación (compilador y flags) e imagen
+func CompileCacheKey(sourceCode, compileCommand, imageID string) string {
+	h := sha256.New()
+	h.Write([]byte(imageID))
+	h.Write([]byte{0})
+	h.Write([]byte(compileCommand))
+	h.Write([]byte{0})
+	h.Write([]byte(sourceCode))
+	return hex.EncodeToString(h.Sum(nil))
+}
+
+// Get retorna el binario asociado a la clave si existe
+func (c *CompileCache) Get(key string) ([]byte, bool) {
+	c.mu.Lock()
+	elem, ok := c.entries[key]
+	if ok {
+		c.lru.MoveToFront(elem)
+	}
+	c.mu.Unlock()
+
+	if !ok {
+		c.misses.Add(1)
+		return nil, false
+	}
+
+	data, err := os.ReadFile(c.path(key))
+	if err != nil {
+		// The file disappeared from disk: forget the entry
+		c.mu.Lock()
+		c.removeElement(elem)
+		c.mu.Unlock()
+		c.misses.Add(1)
+		return nil, false
+	}
+
+	c.hits.Add(1)
+	return data, true
+}
+
+// Put guarda el binario bajo la clave dada y expulsa las entradas menos usadas
+// si se supera el tamaño máximo
+func (c *CompileCache) Put(key string, data []byte) error {
+	size := int64(len(data))
+	if size > c.maxBytes {
+		return fmt.Errorf("binary of %d bytes exceeds compile cache size", size)
+	}
+
+	// Write to a temporary file and rename so readers never see partial binaries
+	tmp, err := os.CreateTemp(c.dir, key+".tmp-*")
+	if err != nil {
+		return fmt.Errorf("failed to create compile cache file: %w", err)
+	}
+	if _, err := tmp.Write(data); err != nil {
+		tmp.Close()
+		os.Remove(tmp.Name())
+		return fmt.Errorf("failed to write compile cache file: %w", err)
+	}
+	if err := tmp.Close(); err != nil {
+		os.Remove(tmp.Name())
+		return fmt.Errorf("failed to write compile cache file: %w", err)
+	}
+	if err := os.Rename(tmp.Name(), c.path(key)); err != nil {
+		os.Remove(tmp.Name())
+		return fmt.Errorf("failed to store compile cache file: %w", err)
+	}
+
+	c.mu.Lock()
+	defer c.mu.Unlock()
+
+	if elem, ok := c.entries[key]; ok {
+		c.totalBytes -= elem.Value.(*compileCacheEntry).size
+		elem.Value.(*compileCacheEntry).size = size
+		c.totalBytes += size
+		c.lru.MoveToFront(elem)
+	} else {
+		c.entries[key] = c.lru.PushFront(&compileCacheEntry{key: key, size: size})
+		c.totalBytes += size
+	}
+
+	c.evict()
+	return nil
+}
+
+// Stats retorna los contadores de aciertos y fallos del cache
+func (c *CompileCache) Stats() (hits, misses int64) {
+	return c.hits.Load(), c.misses.Load()
+}
+
+// evict elimina las entradas menos usadas hasta respetar maxBytes (requiere c.mu)
+func (c *CompileCache) evict() {
+	for c.totalBytes > c.maxBytes {
+		oldest := c.lru.Back()
+		if oldest == nil {
+			return
+		}
+		entry := oldest.Value.(*compileCacheEntry)
+		c.removeElement(oldest)
+		if err := os.Remove(c.path(entry.key)); err != nil && !os.IsNotExist(err) {
+			log.Printf("  ⚠️  Warning: failed to evict compile cache entry %s: %v", entry.key[:12], err)
+		}
+	}
+}
+
+// removeElement quita una entrada del índice en memoria (requiere c.mu)
+func (c *CompileCache) removeElement(elem *list.Element) {
+	entry := elem.Value.(*compileCacheEntry)
+	if _, ok := c.entries[entry.key]; !ok {
+		return
+	}
+	delete(c.entries, entry.key)
+	c.lru.Remove(elem)
+	c.totalBytes -= entry.size
+}
+
+// load reconstruye el índice a partir de los binarios existentes en disco,
+// usando la fecha de modificación como orden de uso
+func (c *CompileCache) load() error {
+	dirEntries, err := os.ReadDir(c.dir)
+	if err != nil {
+		return fmt.Errorf("failed to read compile cache directory: %w", err)
+	}
+
+	type diskEntry struct {
+		key  string
+		size int64
+		mod  int64
+	}
+	var found []diskEntry
+
+	for _, de := range dirEntries {
+		if de.IsDir() {
+			continue
+		}
+		info, err := de.Info()
+		if err != nil {
+			continue
+		}
+		if len(de.Name()) != sha256.Size*2 {
+			// Leftover temporary file from an interrupted Put
+			os.Remove(filepath.Join(c.dir, de.Name()))
+			continue
+		}
+		found = append(found, diskEntry{key: de.Name(), size: info.Size(), mod: info.ModTime().UnixNano()})
+	}
+
+	// Oldest first, so the most recent ends up at the front
+	sort.Slice(found, func(i, j int) bool { return found[i].mod < found[j].mod })
+	for _, d := range found {
+		c.entries[d.key] = c.lru.PushFront(&compileCacheEntry{key: d.key, size: d.size})
+		c.totalBytes += d.size
+	}
+
+	c.evict()
+	return nil
+}
+
+// path retorna la ruta en disco del binario para la clave dada
+func (c *CompileCache) path(key string) string {
+	return filepath.Join(c.dir, key)
+}
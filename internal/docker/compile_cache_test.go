@@ -0,0 +1,110 @@
+package docker
+
+import (
+	"bytes"
+	"strings"
+	"testing"
+
+	"github.com/google/uuid"
+)
+
+func TestCompileCacheKey_DependsOnAllInputs(t *testing.T) {
+	base := CompileCacheKey("int main() {}", "-std=c++17", "sha256:abc")
+
+	if base != CompileCacheKey("int main() {}", "-std=c++17", "sha256:abc") {
+		t.Errorf("Expected identical inputs to produce the same key")
+	}
+	if base == CompileCacheKey("int main() { }", "-std=c++17", "sha256:abc") {
+		t.Errorf("Expected key to change with the source code")
+	}
+	if base == CompileCacheKey("int main() {}", "-std=c++20", "sha256:abc") {
+		t.Errorf("Expected key to change with the compile flags")
+	}
+	if base == CompileCacheKey("int main() {}", "-std=c++17", "sha256:def") {
+		t.Errorf("Expected key to change with the image")
+	}
+}
+
+func TestCompileCache_PutGetAndEvict(t *testing.T) {
+	dir := t.TempDir()
+	cache, err := NewCompileCache(dir, 10)
+	if err != nil {
+		t.Fatalf("Expected no error, got: %v", err)
+	}
+
+	keyA := CompileCacheKey("a", "g++ -std=c++17", "img")
+	keyB := CompileCacheKey("b", "g++ -std=c++17", "img")
+	keyC := CompileCacheKey("c", "g++ -std=c++17", "img")
+
+	if err := cache.Put(keyA, []byte("aaaa")); err != nil {
+		t.Fatalf("Expected no error, got: %v", err)
+	}
+	if err := cache.Put(keyB, []byte("bbbb")); err != nil {
+		t.Fatalf("Expected no error, got: %v", err)
+	}
+
+	// Touch A so that B becomes the least recently used entry
+	if data, ok := cache.Get(keyA); !ok || !bytes.Equal(data, []byte("aaaa")) {
+		t.Fatalf("Expected cache hit for A, got ok=%v data=%q", ok, data)
+	}
+
+	if err := cache.Put(keyC, []byte("cccc")); err != nil {
+		t.Fatalf("Expected no error, got: %v", err)
+	}
+
+	if _, ok := cache.Get(keyB); ok {
+		t.Errorf("Expected B to be evicted")
+	}
+	if _, ok := cache.Get(keyA); !ok {
+		t.Errorf("Expected A to remain cached")
+	}
+
+	hits, misses := cache.Stats()
+	if hits != 2 || misses != 1 {
+		t.Errorf("Expected 2 hits and 1 miss, got %d hits and %d misses", hits, misses)
+	}
+
+	// Reopening the cache must find the entries left on disk
+	reopened, err := NewCompileCache(dir, 10)
+	if err != nil {
+		t.Fatalf("Expected no error, got: %v", err)
+	}
+	if data, ok := reopened.Get(keyC); !ok || !bytes.Equal(data, []byte("cccc")) {
+		t.Errorf("Expected C to survive a restart, got ok=%v data=%q", ok, data)
+	}
+}
+
+func TestPlanCompilation_ReusesTestObject(t *testing.T) {
+	cache, err := NewCompileCache(t.TempDir(), 1<<20)
+	if err != nil {
+		t.Fatalf("Expected no error, got: %v", err)
+	}
+	executor := &DockerExecutor{dockerConfig: DefaultDockerConfig(), compileCache: cache}
+
+	config := DefaultExecutionConfig(uuid.New(), "full template")
+	config.SolutionUnit = "int add(int a, int b) { return a + b; }"
+	config.Declarations = "#pragma once\nint add(int a, int b);\n"
+	config.TestUnit = `#include "doctest.h"` + "\n" + `#include "solution.h"` + "\n"
+
+	// First solution for this test set: the tests are compiled and the object is cached
+	plan := executor.planCompilation(config, "", "img")
+	if plan.objectKey == "" || !strings.HasPrefix(plan.command, config.Compiler.TestObjectCommand("")+" && ") {
+		t.Fatalf("Expected the test unit to be compiled, got command %q", plan.command)
+	}
+	if len(plan.files) != 3 {
+		t.Fatalf("Expected solution.cpp, solution.h and tests.cpp, got %d files", len(plan.files))
+	}
+	if err := cache.Put(plan.objectKey, []byte("object")); err != nil {
+		t.Fatalf("Expected no error, got: %v", err)
+	}
+
+	// A different solution against the same tests only compiles solution.cpp
+	config.SolutionUnit = "int add(int a, int b) { return b + a; }"
+	plan = executor.planCompilation(config, "", "img")
+	if plan.objectKey != "" || plan.command != config.Compiler.SplitCompileCommand("") {
+		t.Errorf("Expected only the solution to be compiled, got command %q", plan.command)
+	}
+	if len(plan.files) != 2 || plan.files[1].Name != testObjectFileName || string(plan.files[1].Data) != "object" {
+		t.Errorf("Expected the cached test object in the workspace, got %+v", plan.files)
+	}
+}
@@ -0,0 +1,167 @@
+package docker
+
+import (
+	"fmt"
+	"strings"
+)
+
+// Valores permitidos de cada campo de CompilerProfile. Están atados a lo que instala la
+// imagen coderunner-cpp (g++ 13 y clang).
+//
+// Solo algunos perfiles tienen header precompilado de doctest (ver HasPrecompiledHeader y
+// docker/cpp/Dockerfile): gcc, c++17 o c++20, O0 u O2, sin -march y sin sanitizers. El
+// resto (c++14, O1/O3/Os, -march, sanitizers y todo clang) parsea doctest.h completo en
+// cada compilación, lo que suma unos segundos a los envíos que no salen del cache.
+//
+// -march=native no está permitido: el binario depende de la CPU del host que lo compiló y
+// el cache de compilación (que puede estar en un volumen compartido) no la incluye en la clave.
+var (
+	allowedCompilers     = []string{"gcc", "clang"}
+	allowedStandards     = []string{"c++14", "c++17", "c++20"}
+	allowedOptimizations = []string{"O0", "O1", "O2", "O3", "Os"}
+	allowedArchitectures = []string{"", "x86-64-v2", "x86-64-v3"}
+)
+
+// Estándares y niveles de optimización con header precompilado de doctest en la imagen
+var (
+	precompiledStandards     = []string{"c++17", "c++20"}
+	precompiledOptimizations = []string{"O0", "O2"}
+)
+
+// sanitizerFlags activan AddressSanitizer y UndefinedBehaviorSanitizer; un comportamiento
+// indefinido aborta el test en lugar de solo imprimir un aviso
+const sanitizerFlags = "-fsanitize=address,undefined -fno-sanitize-recover=undefined -fno-omit-frame-pointer"
+
+// CompilerProfile describe cómo se compila una solución: compilador, estándar, nivel de
+// optimización, arquitectura y sanitizers. Forma parte del comando de compilación y, por
+// lo tanto, de la clave del cache de compilación.
+type CompilerProfile struct {
+	Compiler     string // gcc | clang
+	Standard     string // c++14 | c++17 | c++20
+	Optimization string // O0 | O1 | O2 | O3 | Os
+	March        string // Vacío (arquitectura base), x86-64-v2 o x86-64-v3
+	Sanitizers   bool   // AddressSanitizer + UndefinedBehaviorSanitizer
+}
+
+// DefaultCompilerProfile retorna el perfil por defecto: g++ -std=c++17 -O0, el más rápido
+// de compilar y el que usa el header precompilado de doctest
+func DefaultCompilerProfile() CompilerProfile {
+	return CompilerProfile{
+		Compiler:     "gcc",
+		Standard:     "c++17",
+		Optimization: "O0",
+	}
+}
+
+// WithDefaults completa los campos vacíos con los del perfil por defecto
+func (p CompilerProfile) WithDefaults() CompilerProfile {
+	defaults := DefaultCompilerProfile()
+	if p.Compiler == "" {
+		p.Compiler = defaults.Compiler
+	}
+	if p.Standard == "" {
+		p.Standard = defaults.Standard
+	}
+	if p.Optimization == "" {
+		p.Optimization = defaults.Optimization
+	}
+	return p
+}
+
+// Validate verifica cada campo contra la lista de valores permitidos
+func (p CompilerProfile) Validate() error {
+	fields := []struct {
+		name    string
+		value   string
+		allowed []string
+	}{
+		{"compiler", p.Compiler, allowedCompilers},
+		{"standard", p.Standard, allowedStandards},
+		{"optimization", p.Optimization, allowedOptimizations},
+		{"march", p.March, allowedArchitectures},
+	}
+
+	for _, field := range fields {
+		if !containsString(field.allowed, field.value) {
+			return fmt.Errorf("unsupported compiler profile %s %q (allowed: %s)", field.name, field.value, strings.Join(field.allowed, ", "))
+		}
+	}
+	return nil
+}
+
+// HasPrecompiledHeader indica si la imagen trae un header precompilado de doctest para
+// este perfil; sin él, cada compilación parsea doctest.h completo
+func (p CompilerProfile) HasPrecompiledHeader() bool {
+	return p.Compiler == "gcc" && p.March == "" && !p.Sanitizers &&
+		containsString(precompiledStandards, p.Standard) &&
+		containsString(precompiledOptimizations, p.Optimization)
+}
+
+// CompileCommand retorna el comando que compila solution.cpp en ./solution con este perfil,
+// más extraFlags (por ejemplo -static). La biblioteca con el runtime de doctest se enlaza
+// después de solution.cpp para que el linker resuelva main() desde el archivo.
+func (p CompilerProfile) CompileCommand(extraFlags string) string {
+	compiler, libDir := p.toolchain()
+	return fmt.Sprintf("%s %s solution.cpp -L%s -lcoderunner_doctest -o solution", compiler, p.flags(extraFlags), libDir)
+}
+
+// TestObjectCommand retorna el comando que compila la unidad de tests (tests.cpp) en
+// tests.o, sin enlazar. Usa los mismos flags que la solución para que ambos objetos sean
+// compatibles entre sí.
+func (p CompilerProfile) TestObjectCommand(extraFlags string) string {
+	compiler, _ := p.toolchain()
+	return fmt.Sprintf("%s %s -c tests.cpp -o tests.o", compiler, p.flags(extraFlags))
+}
+
+// SplitCompileCommand retorna el comando que compila solution.cpp y lo enlaza con tests.o
+// y el runtime de doctest en ./solution
+func (p CompilerProfile) SplitCompileCommand(extraFlags string) string {
+	compiler, libDir := p.toolchain()
+	return fmt.Sprintf("%s %s solution.cpp tests.o -L%s -lcoderunner_doctest -o solution", compiler, p.flags(extraFlags), libDir)
+}
+
+// toolchain retorna el driver del compilador y el directorio con su build del runtime
+func (p CompilerProfile) toolchain() (string, string) {
+	if p.Compiler == "clang" {
+		// clang links its own build of the runtime (see docker/cpp/Dockerfile)
+		return "clang++", "/opt/coderunner/lib/clang"
+	}
+	return "g++", "/opt/coderunner/lib"
+}
+
+// flags retorna los flags de compilación del perfil seguidos de extraFlags
+func (p CompilerProfile) flags(extraFlags string) string {
+	flags := []string{"-std=" + p.Standard, "-" + p.Optimization}
+	if p.March != "" {
+		flags = append(flags, "-march="+p.March)
+	}
+	if p.Sanitizers {
+		flags = append(flags, sanitizerFlags)
+	}
+	if extraFlags != "" {
+		flags = append(flags, extraFlags)
+	}
+	return strings.Join(flags, " ")
+}
+
+// String retorna el perfil en una forma compacta para logs y claves de deduplicación
+func (p CompilerProfile) String() string {
+	s := fmt.Sprintf("%s -std=%s -%s", p.Compiler, p.Standard, p.Optimization)
+	if p.March != "" {
+		s += " -march=" + p.March
+	}
+	if p.Sanitizers {
+		s += " +sanitizers"
+	}
+	return s
+}
+
+// containsString indica si values contiene value
+func containsString(values []string, value string) bool {
+	for _, v := range values {
+		if v == value {
+			return true
+		}
+	}
+	return false
+}
@@ -0,0 +1,65 @@
+package docker
+
+import (
+	"strings"
+	"testing"
+)
+
+func TestCompilerProfile_Validate(t *testing.T) {
+	if err := DefaultCompilerProfile().Validate(); err != nil {
+		t.Fatalf("Expected the default profile to be valid, got: %v", err)
+	}
+
+	valid := CompilerProfile{Compiler: "clang", Standard: "c++20", Optimization: "O2", March: "x86-64-v3", Sanitizers: true}
+	if err := valid.Validate(); err != nil {
+		t.Errorf("Expected %s to be valid, got: %v", valid, err)
+	}
+
+	invalid := []CompilerProfile{
+		{Compiler: "icc", Standard: "c++17", Optimization: "O0"},
+		{Compiler: "gcc", Standard: "gnu++17", Optimization: "O0"},
+		{Compiler: "gcc", Standard: "c++17", Optimization: "O2 -fplugin=x.so"},
+		{Compiler: "gcc", Standard: "c++17", Optimization: "O0", March: "skylake; rm -rf /"},
+		{Compiler: "gcc", Standard: "c++17", Optimization: "O2", March: "native"},
+		{},
+	}
+	for _, profile := range invalid {
+		if err := profile.Validate(); err == nil {
+			t.Errorf("Expected %+v to be rejected", profile)
+		}
+	}
+}
+
+func TestCompilerProfile_HasPrecompiledHeader(t *testing.T) {
+	if !DefaultCompilerProfile().HasPrecompiledHeader() {
+		t.Errorf("Expected the default profile to use the precompiled header")
+	}
+
+	without := []CompilerProfile{
+		{Compiler: "clang", Standard: "c++17", Optimization: "O0"},
+		{Compiler: "gcc", Standard: "c++14", Optimization: "O0"},
+		{Compiler: "gcc", Standard: "c++17", Optimization: "O3"},
+		{Compiler: "gcc", Standard: "c++17", Optimization: "O2", March: "x86-64-v3"},
+		{Compiler: "gcc", Standard: "c++20", Optimization: "O2", Sanitizers: true},
+	}
+	for _, profile := range without {
+		if profile.HasPrecompiledHeader() {
+			t.Errorf("Expected %s to have no precompiled header", profile)
+		}
+	}
+}
+
+func TestCompilerProfile_CompileCommand(t *testing.T) {
+	command := DefaultCompilerProfile().CompileCommand("")
+	if command != "g++ -std=c++17 -O0 solution.cpp -L/opt/coderunner/lib -lcoderunner_doctest -o solution" {
+		t.Errorf("Unexpected default compile command: %s", command)
+	}
+
+	profile := CompilerProfile{Compiler: "clang", Standard: "c++20", Optimization: "O2", March: "x86-64-v3", Sanitizers: true}
+	command = profile.CompileCommand("-static")
+	for _, want := range []string{"clang++ ", "-std=c++20", "-O2", "-march=x86-64-v3", "-fsanitize=address,undefined", "-static", "-L/opt/coderunner/lib/clang"} {
+		if !strings.Contains(command, want) {
+			t.Errorf("Expected %q in compile command: %s", want, command)
+		}
+	}
+}
@@ -1,17 +1,54 @@
 package docker
 
 import (
+	"bytes"
 	"context"
+	"errors"
 	"fmt"
+	"io"
 	"log"
+	"path"
 	"strings"
 	"time"
 
 	"github.com/docker/docker/api/types/container"
 	"github.com/docker/docker/pkg/stdcopy"
+	"go.opentelemetry.io/otel/attribute"
+	"go.opentelemetry.io/otel/trace"
+
+	"code-runner/internal/metrics"
+	"code-runner/internal/tracing"
 )
 
-// Execute ejecuta el código en un contenedor Docker
+// harnessArgs retorna los argumentos de línea de comandos del main() del harness para la
+// ejecución. En modo fail-fast, --abort-after=1 detiene la corrida en el primer fallo; con
+// ForkPerTest, --coderunner-fork-tests ejecuta cada TEST_CASE en su propio proceso. Un
+// límite de tiempo por test (--coderunner-test-timeout-ms) también implica el modo fork.
+// --abort-after cuenta aserciones fallidas con y sin fork (en modo fork, un test que crashea
+// o hace timeout cuenta como una), así que se detiene en el mismo punto en ambos modos.
+func (e *DockerExecutor) harnessArgs(config *ExecutionConfig) []string {
+	var args []string
+	if limit := e.testTimeLimitMS(config); limit > 0 {
+		args = append(args, fmt.Sprintf("--coderunner-test-timeout-ms=%d", limit))
+	} else if e.dockerConfig.ForkPerTest {
+		args = append(args, "--coderunner-fork-tests")
+	}
+	if config.FailFast {
+		args = append(args, "--abort-after=1")
+	}
+	return args
+}
+
+// testTimeLimitMS retorna el límite por test de la ejecución, o el del servicio si no tiene
+func (e *DockerExecutor) testTimeLimitMS(config *ExecutionConfig) int64 {
+	if config.TestTimeLimitMS > 0 {
+		return config.TestTimeLimitMS
+	}
+	return e.dockerConfig.TestTimeLimitMS
+}
+
+// Execute ejecuta el código en un contenedor Docker en dos fases (compilación y ejecución),
+// cada una con su propio timeout, límites de recursos y salida capturada
 func (e *DockerExecutor) Execute(ctx context.Context, config *ExecutionConfig) (*ExecutionResult, error) {
 	startTime := time.Now()
 	log.Printf("🐳 Starting Docker execution for ExecutionID: %s", config.ExecutionID)
@@ -21,57 +58,160 @@ func (e *DockerExecutor) Execute(ctx context.Context, config *ExecutionConfig) (
 		Success:     false,
 	}
 
-	// Setup filesystem
-	executionDir, err := e.setupExecutionDirectory(config)
+	// Ensure image exists
+	imageID, err := e.ensureImage(ctx, config.ImageName)
 	if err != nil {
-		return nil, err
+		return nil, fmt.Errorf("failed to ensure image: %w", err)
 	}
 
-	// Ensure image exists
-	if err := e.ensureImage(ctx, config.ImageName); err != nil {
-		return nil, fmt.Errorf("failed to ensure image: %w", err)
+	// Look up a previously compiled binary for this exact source, compile command and image
+	compileCommand := config.Compiler.CompileCommand("")
+	cacheKey, binary := e.lookupCompiledBinary(config, compileCommand, imageID, result)
+	var plan compilePlan
+	if binary != nil {
+		plan.files = []workspaceFile{
+			{Name: "solution.cpp", Data: []byte(config.SourceCode), Mode: 0644},
+			{Name: "solution", Data: binary, Mode: 0755},
+		}
+	} else {
+		plan = e.planCompilation(config, "", imageID)
 	}
 
-	// Create container
-	containerID, err := e.createContainer(ctx, config, executionDir)
+	// Take a warm container from the pool (or create a dedicated one)
+	sb, err := e.acquireSandbox(ctx, config)
 	if err != nil {
 		return nil, err
 	}
 
-	// Cleanup after execution
+	// Return the container to the pool (or destroy it) after execution
+	workDir := path.Join(config.WorkDir, config.ExecutionID.String())
+	contaminated := false
 	defer func() {
-		cleanupCtx, cancel := context.WithTimeout(context.Background(), 10*time.Second)
-		defer cancel()
-		if err := e.Cleanup(cleanupCtx, containerID); err != nil {
-			log.Printf("  ⚠️  Warning: failed to cleanup container: %v", err)
-		}
+		e.releaseSandbox(ctx, sb, workDir, contaminated)
 	}()
 
-	// Execute with timeout
-	exitCode, timedOut, err := e.runContainer(ctx, config, containerID)
+	// Copy source code (and cached binary) into a per-execution directory inside the container
+	if err := e.copyWorkspaceToContainer(ctx, sb.id, workDir, plan.files); err != nil {
+		contaminated = true
+		return nil, err
+	}
+
+	// Phase 1: compilation (skipped entirely on a compile cache hit)
+	if !result.CompileCacheHit {
+		compiled, err := e.compilePhase(ctx, sb, workDir, config, plan.command, result)
+		if err != nil {
+			contaminated = true
+			return nil, err
+		}
+		if !compiled {
+			contaminated = contaminated || result.TimedOut || result.ExitCode == 137 || result.ErrorType == "output_limit_exceeded"
+			result.ExecutionTimeMS = time.Since(startTime).Milliseconds()
+			e.logExecutionResults(result)
+			return result, nil
+		}
+
+		// Cache the binary and the test object before the student's code gets a chance to touch them
+		if cacheKey != "" {
+			if binary, err := e.readFileFromContainer(ctx, sb.id, path.Join(workDir, "solution"), 0); err == nil {
+				e.storeCompiledBinary(cacheKey, binary)
+			}
+		}
+		e.storeTestObject(ctx, sb.id, workDir, plan)
+	}
+
+	result.Compiled = true
+
+	// Phase 2: execution
+	if err := e.applyResourceLimits(ctx, sb, config.MemoryLimitMB, config.CPULimit); err != nil {
+		contaminated = true
+		return nil, err
+	}
+
+	config.emitProgress(ProgressEvent{Phase: PhaseRunning})
+	runStart := time.Now()
+	shards := planTestShards(len(config.TestIDs), e.testShardCount(config))
+	runCtx, runSpan := tracing.Start(ctx, "run", trace.WithAttributes(
+		attribute.Int("coderunner.tests", len(config.TestIDs)),
+		attribute.Int("coderunner.shards", len(shards)),
+	))
+	output, err := e.runTestShards(runCtx, sb.id, workDir, config, shards)
+	result.RunTimeMS = time.Since(runStart).Milliseconds()
+	metrics.ObserveStage(metrics.StageRun, runStart)
+	tracing.End(runSpan, err)
 	if err != nil {
+		contaminated = true
 		return nil, err
 	}
 
-	if timedOut {
-		result.TimedOut = true
-		result.ErrorType = "timeout"
-		result.ErrorMessage = fmt.Sprintf("Execution timed out after %d seconds", config.TimeoutSeconds)
-		log.Printf("  ⏱️  Execution timed out")
+	if output.TimedOut {
+		// The process may still be running: never reuse this container
+		contaminated = true
+		e.collectShardResults(ctx, sb.id, shards, result, output)
+		result.ExecutionTimeMS = time.Since(startTime).Milliseconds()
+		e.buildTimedOutResult(result, output, config)
 		return result, nil
 	}
 
-	// Capture logs
-	stdout, stderr, err := e.captureLogs(ctx, containerID)
+	if output.OutputLimitExceeded {
+		// The process may still be writing: never reuse this container
+		contaminated = true
+		applyOutputLimitExceeded(result, output, e.dockerConfig.MaxOutputBytes, "Execution")
+		result.ExecutionTimeMS = time.Since(startTime).Milliseconds()
+		e.logExecutionResults(result)
+		return result, nil
+	}
+
+	// A SIGKILL (OOM killer, pids limit...) leaves the container in an unknown state
+	if output.ExitCode == 137 {
+		contaminated = true
+	}
+
+	e.collectShardResults(ctx, sb.id, shards, result, output)
+
+	result.ExecutionTimeMS = time.Since(startTime).Milliseconds()
+	_, parseSpan := tracing.Start(ctx, "parse")
+	e.buildRunResult(result, output, config)
+	parseSpan.End()
+	return result, nil
+}
+
+// readProcessStats lee el consumo de la solución registrado por measure en statsPath. Falla
+// si no está disponible (imagen sin measure, proceso measure muerto); en ese caso las
+// métricas quedan en cero.
+func (e *DockerExecutor) readProcessStats(ctx context.Context, containerID, statsPath string) (*processStats, error) {
+	data, err := e.readFileFromContainer(ctx, containerID, statsPath, maxProcessStatsBytes)
 	if err != nil {
 		return nil, err
 	}
+	stats, err := parseProcessStats(data)
+	if err != nil {
+		return nil, fmt.Errorf("invalid process stats: %w", err)
+	}
+	return stats, nil
+}
+
+// collectTestReport lee el reporte de tests que el harness escribió en el fd que le pasa
+// measure. Retorna nil si no existe o excede maxTestReportBytes (se usa el stdout).
+func (e *DockerExecutor) collectTestReport(ctx context.Context, containerID, reportPath string) []byte {
+	report, err := e.readFileFromContainer(ctx, containerID, reportPath, maxTestReportBytes)
+	if err != nil {
+		log.Printf("  ⚠️  Test report not available: %v", err)
+		return nil
+	}
+	return report
+}
+
+// buildRunResult completa el resultado con la salida de la fase de ejecución:
+// interpreta el reporte de tests con el parser del lenguaje y clasifica errores de runtime
+func (e *DockerExecutor) buildRunResult(result *ExecutionResult, output *commandOutput, config *ExecutionConfig) {
+	defer metrics.ObserveStage(metrics.StageParse, time.Now())
+
+	exitCode := output.ExitCode
 
 	// Build result
-	result.StdOut = stdout
-	result.StdErr = stderr
+	result.StdOut = output.StdOut
+	result.StdErr = output.StdErr
 	result.ExitCode = exitCode
-	result.ExecutionTimeMS = time.Since(startTime).Milliseconds()
 	result.Success = (exitCode == 0)
 
 	e.logExecutionResults(result)
@@ -81,11 +221,30 @@ func (e *DockerExecutor) Execute(ctx context.Context, config *ExecutionConfig) (
 		log.Printf("  ⚠️  Warning: no parser strategy for language %s: %v", config.Language, parserErr)
 	}
 
+	// Prefer the harness report: it does not depend on what the solution prints
+	var testResults []TestResult
+	var err error
 	parsed := false
-	if parser != nil && parser.DetectsOutput(result.StdOut) {
-		testResults, err := parser.Parse(result.StdOut, config.TestIDs)
+	if reportParser, ok := parser.(ReportParser); ok && len(output.Report) > 0 {
+		testResults, err = reportParser.ParseReport(bytes.NewReader(output.Report), config.TestIDs, exitCode)
+		parsed = true
+		if errors.Is(err, ErrIncompleteReport) && output.TimedOut {
+			// Cut short by the timeout: the tests that finished keep their results
+			err = nil
+		}
+	} else if parser != nil && parser.DetectsOutput(result.StdOut) {
+		testResults, err = parser.Parse(result.StdOut, config.TestIDs)
+		parsed = true
+	}
+
+	untrusted := errors.Is(err, ErrIncompleteReport) || errors.Is(err, ErrReportExitMismatch)
+	if parsed {
 		if err != nil {
 			log.Printf("  ⚠️  Warning: Error parsing test results: %v", err)
+			errorMessage := "Parsing failed"
+			if untrusted {
+				errorMessage = fmt.Sprintf("Test run did not complete (exit code %d)", exitCode)
+			}
 			// Fallback: mark all as failed
 			result.TotalTests = len(config.TestIDs)
 			result.PassedTests = 0
@@ -96,10 +255,9 @@ func (e *DockerExecutor) Execute(ctx context.Context, config *ExecutionConfig) (
 					TestID:       testID,
 					TestName:     testID,
 					Passed:       false,
-					ErrorMessage: "Parsing failed",
+					ErrorMessage: errorMessage,
 				})
 			}
-			parsed = true
 		} else {
 			result.TestResults = testResults
 			result.TotalTests = len(testResults)
@@ -112,174 +270,493 @@ func (e *DockerExecutor) Execute(ctx context.Context, config *ExecutionConfig) (
 					result.FailedTests++
 				}
 			}
-			parsed = true
 		}
 	}
 
 	if parsed {
 		result.Success = (exitCode == 0) && result.FailedTests == 0 && result.TotalTests > 0
+		applyTestTimeLimits(result)
 	}
 
-	if !parsed && exitCode != 0 {
-		// Compilation or runtime error - detect error type
+	if (!parsed || untrusted) && exitCode != 0 {
+		// Runtime error - detect error type
 		e.detectErrorType(result)
 	}
+}
 
-	return result, nil
+// buildTimedOutResult completa el resultado de una corrida cortada por el timeout de la
+// ejecución. Los tests que llegaron a terminar conservan su resultado y el que seguía
+// corriendo se reporta como time_limit_exceeded, en lugar de perder todos los resultados.
+func (e *DockerExecutor) buildTimedOutResult(result *ExecutionResult, output *commandOutput, config *ExecutionConfig) {
+	log.Printf("  ⏱️  Execution timed out")
+	if len(output.Report) > 0 {
+		e.buildRunResult(result, output, config)
+		for i := range result.TestResults {
+			if tr := &result.TestResults[i]; tr.unfinished {
+				tr.ErrorType = TestErrorTimeLimitExceeded
+				tr.ErrorMessage = fmt.Sprintf("Time limit exceeded: the test was still running when the execution timed out after %d seconds", config.TimeoutSeconds)
+			}
+		}
+	}
+
+	result.Success = false
+	result.TimedOut = true
+	result.ErrorType = "timeout"
+	result.ErrorMessage = fmt.Sprintf("Execution timed out after %d seconds", config.TimeoutSeconds)
+}
+
+// applyTestTimeLimits marca la ejecución como time_limit_exceeded si algún test superó su
+// límite de tiempo y no hay otro error que reportar
+func applyTestTimeLimits(result *ExecutionResult) {
+	var exceeded []string
+	for _, tr := range result.TestResults {
+		if tr.ErrorType == TestErrorTimeLimitExceeded {
+			exceeded = append(exceeded, tr.TestID)
+		}
+	}
+	if len(exceeded) == 0 || result.ErrorType != "" {
+		return
+	}
+
+	result.ErrorType = TestErrorTimeLimitExceeded
+	result.ErrorMessage = fmt.Sprintf("%d test(s) exceeded the time limit: %s", len(exceeded), strings.Join(exceeded, ", "))
+	log.Printf("  ⏱️  TIME LIMIT EXCEEDED: %d test(s)", len(exceeded))
 }
 
-// createContainer crea y configura un nuevo contenedor Docker
-func (e *DockerExecutor) createContainer(ctx context.Context, config *ExecutionConfig, executionDir string) (string, error) {
+// compilePhase compila la solución dentro del contenedor con los límites de compilación.
+// Retorna false si la compilación no produjo un binario; en ese caso el resultado ya
+// contiene el log de compilación y el tipo de error.
+func (e *DockerExecutor) compilePhase(ctx context.Context, sb *sandbox, workDir string, config *ExecutionConfig, command string, result *ExecutionResult) (bool, error) {
+	if err := e.applyResourceLimits(ctx, sb, config.CompileMemoryLimitMB, config.CompileCPULimit); err != nil {
+		return false, err
+	}
+
+	log.Printf("  🔨 Compiling solution with %s (timeout: %ds)", config.Compiler, config.CompileTimeoutSeconds)
+	precompiledHeader := config.Compiler.HasPrecompiledHeader()
+	if !precompiledHeader {
+		log.Printf("  ℹ️  No precompiled doctest header for %s, parsing doctest.h", config.Compiler)
+	}
+	config.emitProgress(ProgressEvent{Phase: PhaseCompiling})
+	compileStart := time.Now()
+	compileCtx, span := tracing.Start(ctx, "compile", trace.WithAttributes(
+		attribute.String("coderunner.compiler", config.Compiler.String()),
+		attribute.Bool("coderunner.precompiled_header", precompiledHeader),
+	))
+	output, err := e.runInContainer(compileCtx, sb.id, workDir, command, time.Duration(config.CompileTimeoutSeconds)*time.Second)
+	result.CompilationTimeMS = time.Since(compileStart).Milliseconds()
+	metrics.ObserveStage(metrics.StageCompile, compileStart)
+	if err == nil {
+		span.SetAttributes(attribute.Int("coderunner.exit_code", output.ExitCode), attribute.Bool("coderunner.timed_out", output.TimedOut))
+	}
+	tracing.End(span, err)
+	if err != nil {
+		return false, err
+	}
+
+	if output.TimedOut {
+		result.TimedOut = true
+		result.ErrorType = "timeout"
+		result.ErrorMessage = fmt.Sprintf("Compilation timed out after %d seconds", config.CompileTimeoutSeconds)
+		log.Printf("  ⏱️  Compilation timed out")
+		return false, nil
+	}
+
+	if output.OutputLimitExceeded {
+		applyOutputLimitExceeded(result, output, e.dockerConfig.MaxOutputBytes, "Compilation")
+		result.CompilationLog = output.StdOut + output.StdErr
+		return false, nil
+	}
+
+	result.CompilationLog = output.StdOut + output.StdErr
+	log.Printf("  ✅ Compilation finished in %dms (exit code: %d)", result.CompilationTimeMS, output.ExitCode)
+
+	if output.ExitCode == 0 {
+		config.emitProgress(ProgressEvent{Phase: PhaseCompiled})
+		return true, nil
+	}
+
+	result.ExitCode = output.ExitCode
+	result.StdErr = output.StdErr
+	if output.ExitCode == 137 {
+		result.ErrorType = "compilation_error"
+		result.ErrorMessage = fmt.Sprintf("Compilation exceeded the memory limit (%d MB)", config.CompileMemoryLimitMB)
+		log.Printf("  🔴 COMPILATION_ERROR DETECTED")
+		log.Printf("  📝 Error: %s", result.ErrorMessage)
+		return false, nil
+	}
+
+	e.detectCompilationError(result)
+	return false, nil
+}
+
+// applyResourceLimits ajusta la memoria y CPU del contenedor para la siguiente fase
+func (e *DockerExecutor) applyResourceLimits(ctx context.Context, sb *sandbox, memoryLimitMB int64, cpuLimit float64) error {
+	if sb.memoryLimitMB == memoryLimitMB && sb.cpuLimit == cpuLimit {
+		return nil
+	}
+
+	memory := memoryLimitMB * 1024 * 1024
+	if _, err := e.client.ContainerUpdate(ctx, sb.id, container.UpdateConfig{
+		Resources: container.Resources{
+			Memory:     memory,
+			MemorySwap: memory,
+			NanoCPUs:   int64(cpuLimit * 1e9),
+		},
+	}); err != nil {
+		return fmt.Errorf("failed to update container resources: %w", err)
+	}
+
+	sb.memoryLimitMB = memoryLimitMB
+	sb.cpuLimit = cpuLimit
+	log.Printf("  🔧 Container limits set: Memory=%dMB, CPU=%.1f cores", memoryLimitMB, cpuLimit)
+	return nil
+}
+
+// lookupCompiledBinary busca en el cache un binario compilado con el mismo código, flags
+// e imagen. Retorna la clave del cache ("" si está deshabilitado) y el binario si hubo hit.
+func (e *DockerExecutor) lookupCompiledBinary(config *ExecutionConfig, compileCommand, imageID string, result *ExecutionResult) (string, []byte) {
+	if e.compileCache == nil {
+		return "", nil
+	}
+
+	cacheKey := CompileCacheKey(config.SourceCode, compileCommand, imageID)
+	binary, ok := e.compileCache.Get(cacheKey)
+	result.CompileCacheHit = ok
+
+	hits, misses := e.compileCache.Stats()
+	if ok {
+		log.Printf("  🗃️  Compile cache HIT (hits=%d, misses=%d)", hits, misses)
+		config.emitProgress(ProgressEvent{Phase: PhaseCompiled, Message: "compile cache hit"})
+	} else {
+		log.Printf("  🗃️  Compile cache MISS (hits=%d, misses=%d)", hits, misses)
+	}
+	return cacheKey, binary
+}
+
+// storeCompiledBinary guarda el binario compilado en el cache de compilación
+func (e *DockerExecutor) storeCompiledBinary(cacheKey string, binary []byte) {
+	if err := e.compileCache.Put(cacheKey, binary); err != nil {
+		log.Printf("  ⚠️  Warning: failed to store binary in compile cache: %v", err)
+		return
+	}
+	log.Printf("  🗃️  Binary stored in compile cache (%d bytes)", len(binary))
+}
+
+// CompileBinary compila la solución en un contenedor con los flags dados y retorna el
+// binario resultante, sin ejecutarlo. Lo usan los executors que corren la fase de
+// ejecución fuera de Docker. Si la compilación falla retorna un binario nil y el
+// resultado con el log y el tipo de error.
+func (e *DockerExecutor) CompileBinary(ctx context.Context, config *ExecutionConfig, extraFlags string) ([]byte, *ExecutionResult, error) {
+	result := &ExecutionResult{
+		ExecutionID: config.ExecutionID,
+		Success:     false,
+	}
+
+	imageID, err := e.ensureImage(ctx, config.ImageName)
+	if err != nil {
+		return nil, nil, fmt.Errorf("failed to ensure image: %w", err)
+	}
+
+	compileCommand := config.Compiler.CompileCommand(extraFlags)
+	cacheKey, binary := e.lookupCompiledBinary(config, compileCommand, imageID, result)
+	if binary != nil {
+		result.Compiled = true
+		return binary, result, nil
+	}
+
+	sb, err := e.acquireSandbox(ctx, config)
+	if err != nil {
+		return nil, nil, err
+	}
+
+	workDir := path.Join(config.WorkDir, config.ExecutionID.String())
+	contaminated := false
+	defer func() {
+		e.releaseSandbox(ctx, sb, workDir, contaminated)
+	}()
+
+	plan := e.planCompilation(config, extraFlags, imageID)
+	if err := e.copyWorkspaceToContainer(ctx, sb.id, workDir, plan.files); err != nil {
+		contaminated = true
+		return nil, nil, err
+	}
+
+	compiled, err := e.compilePhase(ctx, sb, workDir, config, plan.command, result)
+	if err != nil {
+		contaminated = true
+		return nil, nil, err
+	}
+	if !compiled {
+		contaminated = result.TimedOut || result.ExitCode == 137 || result.ErrorType == "output_limit_exceeded"
+		return nil, result, nil
+	}
+
+	binary, err = e.readFileFromContainer(ctx, sb.id, path.Join(workDir, "solution"), 0)
+	if err != nil {
+		return nil, nil, err
+	}
+	if cacheKey != "" {
+		e.storeCompiledBinary(cacheKey, binary)
+	}
+	e.storeTestObject(ctx, sb.id, workDir, plan)
+
+	result.Compiled = true
+	return binary, result, nil
+}
+
+// commandOutput contiene el resultado de ejecutar un comando dentro de un contenedor
+type commandOutput struct {
+	ExitCode int
+	TimedOut bool
+	StdOut   string
+	StdErr   string
+	Report   []byte // Reporte de tests del harness (vacío si no se generó)
+
+	// OutputLimitExceeded indica que el comando se detuvo por superar MaxOutputBytes;
+	// StdOut y StdErr contienen lo capturado hasta el límite
+	OutputLimitExceeded bool
+}
+
+// managedLabel marca los contenedores que crea el executor, para poder encontrar los que
+// quedaron de un proceso anterior
+const managedLabel = "coderunner.managed"
+
+// createContainer crea e inicia un contenedor sandbox que queda en espera
+// (sleep infinity) para recibir ejecuciones vía docker exec
+func (e *DockerExecutor) createContainer(ctx context.Context, imageName, workDir string, memoryLimitMB int64, cpuLimit float64, containerName string) (string, error) {
+	defer metrics.ObserveStage(metrics.StageContainerCreate, time.Now())
+
 	containerConfig := &container.Config{
-		Image:        config.ImageName,
-		WorkingDir:   config.WorkDir,
-		Cmd:          []string{"/bin/bash", "-c", "g++ -std=c++17 solution.cpp -o solution && ./solution"},
-		Tty:          false,
-		AttachStdout: true,
-		AttachStderr: true,
+		Image:      imageName,
+		WorkingDir: workDir,
+		Cmd:        []string{"sleep", "infinity"},
+		Tty:        false,
+		Labels: map[string]string{
+			managedLabel: "true",
+		},
 	}
 
 	hostConfig := &container.HostConfig{
 		Resources: container.Resources{
-			Memory:   config.MemoryLimitMB * 1024 * 1024,
-			NanoCPUs: int64(config.CPULimit * 1e9),
+			Memory:     memoryLimitMB * 1024 * 1024,
+			MemorySwap: memoryLimitMB * 1024 * 1024,
+			NanoCPUs:   int64(cpuLimit * 1e9),
 		},
 		NetworkMode: container.NetworkMode(e.dockerConfig.NetworkMode),
-		Binds: []string{
-			fmt.Sprintf("%s:%s", executionDir, config.WorkDir),
-		},
 		CapDrop:     e.dockerConfig.DropCapabilities,
+		CapAdd:      e.dockerConfig.AddCapabilities,
 		SecurityOpt: e.dockerConfig.SecurityOpt,
+
+		// Everything the execution writes lives in memory and goes away with the container
+		ReadonlyRootfs: e.dockerConfig.ReadOnlyRootFS,
+		Tmpfs:          e.sandboxTmpfs(workDir),
 	}
 
-	log.Printf("  🔧 Container configured: Memory=%dMB, CPU=%.1f cores, Timeout=%ds",
-		config.MemoryLimitMB, config.CPULimit, config.TimeoutSeconds)
+	log.Printf("  🔧 Container configured: Memory=%dMB, CPU=%.1f cores, workspace tmpfs=%dMB", memoryLimitMB, cpuLimit, e.dockerConfig.WorkspaceTmpfsMB)
 
-	containerName := fmt.Sprintf("coderunner-%s", config.ExecutionID.String())
 	resp, err := e.client.ContainerCreate(ctx, containerConfig, hostConfig, nil, nil, containerName)
 	if err != nil {
 		return "", fmt.Errorf("failed to create container: %w", err)
 	}
 
-	log.Printf("  ✅ Container created: %s", resp.ID[:12])
+	if err := e.client.ContainerStart(ctx, resp.ID, container.StartOptions{}); err != nil {
+		e.removeContainer(resp.ID)
+		return "", fmt.Errorf("failed to start container: %w", err)
+	}
+
+	log.Printf("  ✅ Container created and started: %s", resp.ID[:12])
 	return resp.ID, nil
 }
 
-// runContainer ejecuta el contenedor y espera su finalización
-func (e *DockerExecutor) runContainer(ctx context.Context, config *ExecutionConfig, containerID string) (int, bool, error) {
-	execCtx, cancel := context.WithTimeout(ctx, time.Duration(config.TimeoutSeconds)*time.Second)
+// sandboxTmpfs retorna los tmpfs del contenedor: el workspace (ejecutable, donde se
+// compila y corre la solución), /tmp para los temporales de g++ y el directorio de
+// estadísticas de measure, de root. Su contenido cuenta para el límite de memoria.
+func (e *DockerExecutor) sandboxTmpfs(workDir string) map[string]string {
+	return map[string]string{
+		workDir: fmt.Sprintf("rw,exec,nosuid,nodev,size=%dm,uid=%d,gid=%d,mode=0755",
+			e.dockerConfig.WorkspaceTmpfsMB, coderunnerUID, coderunnerUID),
+		"/tmp":                  "rw,noexec,nosuid,nodev,size=32m,mode=1777",
+		path.Dir(statsFilePath): "rw,noexec,nosuid,nodev,size=8m,mode=0700",
+	}
+}
+
+// runInContainer ejecuta un comando de shell dentro del contenedor como el usuario de la imagen
+func (e *DockerExecutor) runInContainer(ctx context.Context, containerID, workDir, command string, timeout time.Duration) (*commandOutput, error) {
+	return e.execInContainer(ctx, containerID, workDir, "", []string{"/bin/bash", "-c", command}, timeout, nil)
+}
+
+// execInContainer ejecuta cmd dentro del contenedor con docker exec (como user, o el
+// usuario de la imagen si está vacío), captura stdout/stderr y espera su finalización
+// respetando el timeout. Si stdoutTap no es nil, además recibe el stdout a medida que llega.
+func (e *DockerExecutor) execInContainer(ctx context.Context, containerID, workDir, user string, cmd []string, timeout time.Duration, stdoutTap io.Writer) (*commandOutput, error) {
+	return e.execWithOutputLimiter(ctx, containerID, workDir, user, cmd, timeout, stdoutTap, nil)
+}
+
+// execWithOutputLimiter es execInContainer con un límite de salida que puede compartirse:
+// si limiter no es nil, cuenta la salida de este exec junto con la de otros y, al
+// superarse, ejecuta el corte que definió el llamador. Con nil el exec tiene su propio
+// límite de MaxOutputBytes y el corte lo detiene solo a él.
+func (e *DockerExecutor) execWithOutputLimiter(ctx context.Context, containerID, workDir, user string, cmd []string, timeout time.Duration, stdoutTap io.Writer, limiter *outputLimiter) (*commandOutput, error) {
+	execCtx, cancel := context.WithTimeout(ctx, timeout)
 	defer cancel()
 
-	if err := e.client.ContainerStart(execCtx, containerID, container.StartOptions{}); err != nil {
-		return 0, false, fmt.Errorf("failed to start container: %w", err)
+	execResp, err := e.client.ContainerExecCreate(execCtx, containerID, container.ExecOptions{
+		Cmd:          cmd,
+		User:         user,
+		WorkingDir:   workDir,
+		AttachStdout: true,
+		AttachStderr: true,
+	})
+	if err != nil {
+		return nil, fmt.Errorf("failed to create exec: %w", err)
 	}
 
-	log.Printf("  🚀 Container started")
+	attach, err := e.client.ContainerExecAttach(execCtx, execResp.ID, container.ExecAttachOptions{})
+	if err != nil {
+		return nil, fmt.Errorf("failed to attach to exec: %w", err)
+	}
+	defer attach.Close()
 
-	statusCh, errCh := e.client.ContainerWait(execCtx, containerID, container.WaitConditionNotRunning)
+	log.Printf("  🚀 Command started in container")
 
-	select {
-	case err := <-errCh:
-		if err != nil {
-			return 0, true, nil // Timeout occurred
-		}
-	case status := <-statusCh:
-		log.Printf("  ✅ Container finished with exit code: %d", status.StatusCode)
-		return int(status.StatusCode), false, nil
+	// Output is consumed while the command runs; going over the cap stops the exec early
+	if limiter == nil {
+		limiter = newOutputLimiter(e.dockerConfig.MaxOutputBytes, cancel)
+	}
+	stdout, stderr := limiter.buffer(), limiter.buffer()
+	var stdoutWriter io.Writer = stdout
+	if stdoutTap != nil {
+		stdoutWriter = io.MultiWriter(stdout, stdoutTap)
 	}
+	copyDone := make(chan error, 1)
+	go func() {
+		_, err := stdcopy.StdCopy(stdoutWriter, stderr, attach.Reader)
+		copyDone <- err
+	}()
 
-	return 0, false, nil
-}
+	// interrupted describes an exec stopped by the timeout or by the output cap
+	interrupted := func() *commandOutput {
+		if limiter.Exceeded() {
+			log.Printf("  📛 Output limit exceeded (%d bytes), command stopped", e.dockerConfig.MaxOutputBytes)
+			return &commandOutput{OutputLimitExceeded: true, StdOut: stdout.String(), StdErr: stderr.String()}
+		}
+		return &commandOutput{TimedOut: true, StdOut: stdout.String(), StdErr: stderr.String()}
+	}
 
-// captureLogs captura stdout y stderr del contenedor
-func (e *DockerExecutor) captureLogs(ctx context.Context, containerID string) (string, string, error) {
-	out, err := e.client.ContainerLogs(ctx, containerID, container.LogsOptions{
-		ShowStdout: true,
-		ShowStderr: true,
-	})
-	if err != nil {
-		return "", "", fmt.Errorf("failed to get container logs: %w", err)
+	select {
+	case err := <-copyDone:
+		if err != nil && !limiter.Exceeded() {
+			log.Printf("  ⚠️  Warning: error reading exec output: %v", err)
+		}
+	case <-execCtx.Done():
+		return interrupted(), nil
 	}
-	defer out.Close()
 
-	var stdout, stderr strings.Builder
-	if _, err := stdcopy.StdCopy(&stdout, &stderr, out); err != nil {
-		log.Printf("  ⚠️  Warning: error reading logs: %v", err)
+	exitCode, err := e.waitExecExit(execCtx, execResp.ID)
+	if err != nil {
+		if execCtx.Err() != nil {
+			return interrupted(), nil
+		}
+		return nil, err
 	}
 
-	return stdout.String(), stderr.String(), nil
+	log.Printf("  ✅ Command finished with exit code: %d", exitCode)
+	return &commandOutput{
+		ExitCode: exitCode,
+		StdOut:   stdout.String(),
+		StdErr:   stderr.String(),
+	}, nil
 }
 
-// detectErrorType detecta el tipo de error basándose en stderr con mejor clasificación
-func (e *DockerExecutor) detectErrorType(result *ExecutionResult) {
-	stderr := result.StdErr
-	lines := strings.Split(stderr, "\n")
+// waitExecExit espera a que Docker reporte el exec como terminado y retorna su exit code.
+// El stream de salida puede cerrarse unos milisegundos antes de que el exec figure como finalizado.
+func (e *DockerExecutor) waitExecExit(ctx context.Context, execID string) (int, error) {
+	for {
+		inspect, err := e.client.ContainerExecInspect(ctx, execID)
+		if err != nil {
+			return 0, fmt.Errorf("failed to inspect exec: %w", err)
+		}
+		if !inspect.Running {
+			return inspect.ExitCode, nil
+		}
 
-	// Detectar errores de compilación con clasificación más detallada
-	if strings.Contains(stderr, "error:") || strings.Contains(stderr, "fatal error:") {
-		result.ErrorType = "compilation_error"
+		select {
+		case <-ctx.Done():
+			return 0, ctx.Err()
+		case <-time.After(10 * time.Millisecond):
+		}
+	}
+}
 
-		// Buscar el primer error específico
-		for _, line := range lines {
-			line = strings.TrimSpace(line)
-			if strings.Contains(line, "error:") {
-				// Clasificar el tipo de error de compilación
-				if strings.Contains(line, "expected") || strings.Contains(line, "syntax error") {
-					result.ErrorType = "syntax_error"
-					result.ErrorMessage = fmt.Sprintf("Syntax error: %s", line)
-				} else if strings.Contains(line, "undefined reference") {
-					result.ErrorType = "linking_error"
-					result.ErrorMessage = fmt.Sprintf("Linking error: %s", line)
-				} else if strings.Contains(line, "no matching function") || strings.Contains(line, "cannot convert") {
-					result.ErrorType = "type_error"
-					result.ErrorMessage = fmt.Sprintf("Type error: %s", line)
-				} else if strings.Contains(line, "redeclared") || strings.Contains(line, "redefinition") {
-					result.ErrorType = "redeclaration_error"
-					result.ErrorMessage = fmt.Sprintf("Redeclaration error: %s", line)
-				} else {
-					result.ErrorMessage = fmt.Sprintf("Compilation error: %s", line)
-				}
-				break
+// detectCompilationError clasifica un error de compilación a partir del log de g++
+func (e *DockerExecutor) detectCompilationError(result *ExecutionResult) {
+	result.ErrorType = "compilation_error"
+
+	// Buscar el primer error específico
+	for _, line := range strings.Split(result.CompilationLog, "\n") {
+		line = strings.TrimSpace(line)
+		if strings.Contains(line, "error:") {
+			// Clasificar el tipo de error de compilación
+			if strings.Contains(line, "expected") || strings.Contains(line, "syntax error") {
+				result.ErrorType = "syntax_error"
+				result.ErrorMessage = fmt.Sprintf("Syntax error: %s", line)
+			} else if strings.Contains(line, "undefined reference") {
+				result.ErrorType = "linking_error"
+				result.ErrorMessage = fmt.Sprintf("Linking error: %s", line)
+			} else if strings.Contains(line, "no matching function") || strings.Contains(line, "cannot convert") {
+				result.ErrorType = "type_error"
+				result.ErrorMessage = fmt.Sprintf("Type error: %s", line)
+			} else if strings.Contains(line, "redeclared") || strings.Contains(line, "redefinition") {
+				result.ErrorType = "redeclaration_error"
+				result.ErrorMessage = fmt.Sprintf("Redeclaration error: %s", line)
+			} else {
+				result.ErrorMessage = fmt.Sprintf("Compilation error: %s", line)
 			}
+			break
 		}
+	}
 
-		if result.ErrorMessage == "" {
-			result.ErrorMessage = "Compilation failed - see stderr for details"
-		}
+	if result.ErrorMessage == "" {
+		result.ErrorMessage = "Compilation failed - see compilation log for details"
+	}
 
-		log.Printf("  🔴 %s DETECTED", strings.ToUpper(result.ErrorType))
-		log.Printf("  📝 Error: %s", result.ErrorMessage)
+	log.Printf("  🔴 %s DETECTED", strings.ToUpper(result.ErrorType))
+	log.Printf("  📝 Error: %s", result.ErrorMessage)
 
-		// No tests passed if compilation failed
-		result.PassedTests = 0
-		result.FailedTests = 0
-		result.TotalTests = 0
-		return
-	}
+	// No tests passed if compilation failed
+	result.PassedTests = 0
+	result.FailedTests = 0
+	result.TotalTests = 0
+}
+
+// detectErrorType detecta el tipo de error de la fase de ejecución basándose en
+// el exit code y stderr
+func (e *DockerExecutor) detectErrorType(result *ExecutionResult) {
+	stderr := result.StdErr
 
-	// Detectar errores de runtime con más casos
-	if strings.Contains(stderr, "Segmentation fault") || strings.Contains(stderr, "core dumped") {
+	// Detectar errores de runtime con más casos (128+señal cuando el proceso muere por una señal)
+	if result.ExitCode == 139 || strings.Contains(stderr, "Segmentation fault") || strings.Contains(stderr, "core dumped") {
 		result.ErrorType = "runtime_error"
 		result.ErrorMessage = "Runtime error: Segmentation fault"
 		log.Printf("  🔴 RUNTIME ERROR: Segmentation fault")
 		return
 	}
 
-	if strings.Contains(stderr, "Floating point exception") {
+	if result.ExitCode == 136 || strings.Contains(stderr, "Floating point exception") {
 		result.ErrorType = "runtime_error"
 		result.ErrorMessage = "Runtime error: Floating point exception"
 		log.Printf("  🔴 RUNTIME ERROR: Floating point exception")
 		return
 	}
 
-	if strings.Contains(stderr, "Aborted") || strings.Contains(stderr, "abort") {
+	if result.ExitCode == 134 || strings.Contains(stderr, "Aborted") || strings.Contains(stderr, "abort") {
 		result.ErrorType = "runtime_error"
 		result.ErrorMessage = "Runtime error: Program aborted"
 		log.Printf("  🔴 RUNTIME ERROR: Program aborted")
 		return
 	}
 
-	// Detectar errores de tiempo de ejecución en tests (si no hay compilación)
+	// Detectar fallos de tests
 	if result.TotalTests > 0 && result.FailedTests > 0 && result.ErrorType == "" {
 		result.ErrorType = "test_failure"
 		result.ErrorMessage = "Some tests failed - check test results"
@@ -311,3 +788,14 @@ func (e *DockerExecutor) Cleanup(ctx context.Context, containerID string) error
 	log.Printf("  ✅ Container cleaned up")
 	return nil
 }
+
+// removeContainer elimina el contenedor de forma inmediata (SIGKILL + remove),
+// usado para descartar contenedores del pool que no pueden reutilizarse
+func (e *DockerExecutor) removeContainer(containerID string) {
+	ctx, cancel := context.WithTimeout(context.Background(), 10*time.Second)
+	defer cancel()
+
+	if err := e.client.ContainerRemove(ctx, containerID, container.RemoveOptions{Force: true}); err != nil {
+		log.Printf("  ⚠️  Warning: failed to remove container %s: %v", containerID[:12], err)
+	}
+}
@@ -3,11 +3,12 @@ package docker
 import (
 	"context"
 	"fmt"
+	"log"
 
 	"github.com/docker/docker/client"
 )
 
-// Executor define la interfaz para ejecutar código en Docker
+// Executor define la interfaz para ejecutar código (DockerExecutor o NativeExecutor)
 type Executor interface {
 	Execute(ctx context.Context, config *ExecutionConfig) (*ExecutionResult, error)
 	BuildImage(ctx context.Context, language string) error
@@ -20,26 +21,72 @@ type DockerExecutor struct {
 	client        *client.Client
 	dockerConfig  *DockerConfig
 	parserFactory *ParserFactory
+	pool          *containerPool
+	compileCache  *CompileCache
 }
 
 // NewDockerExecutor crea una nueva instancia de DockerExecutor
 func NewDockerExecutor() (*DockerExecutor, error) {
+	return NewDockerExecutorWithConfig(DefaultDockerConfig())
+}
+
+// NewDockerExecutorWithConfig crea un DockerExecutor con la configuración dada
+func NewDockerExecutorWithConfig(dockerConfig *DockerConfig) (*DockerExecutor, error) {
 	cli, err := client.NewClientWithOpts(client.FromEnv, client.WithAPIVersionNegotiation())
 	if err != nil {
 		return nil, fmt.Errorf("failed to create Docker client: %w", err)
 	}
 
-	dockerConfig := DefaultDockerConfig()
 	parserFactory := DefaultParserFactory()
 
+	var compileCache *CompileCache
+	if dockerConfig.CompileCacheMaxMB > 0 {
+		compileCache, err = NewCompileCache(dockerConfig.CompileCacheDir, dockerConfig.CompileCacheMaxMB*1024*1024)
+		if err != nil {
+			log.Printf("⚠️  Warning: compile cache disabled: %v", err)
+		}
+	}
+
 	return &DockerExecutor{
 		client:        cli,
 		dockerConfig:  dockerConfig,
 		parserFactory: parserFactory,
+		compileCache:  compileCache,
 	}, nil
 }
 
-// Close cierra el cliente de Docker
+// Close elimina los contenedores del pool y cierra el cliente de Docker
 func (e *DockerExecutor) Close() error {
+	e.drainPool()
 	return e.client.Close()
 }
+
+// CompileCacheStats retorna los aciertos y fallos del cache de compilación
+func (e *DockerExecutor) CompileCacheStats() (hits, misses int64) {
+	if e.compileCache == nil {
+		return 0, 0
+	}
+	return e.compileCache.Stats()
+}
+
+// SuggestedSlots estima cuántas ejecuciones simultáneas soporta el host de Docker,
+// según sus cores y memoria y los límites de la fase de compilación (la más pesada)
+func (e *DockerExecutor) SuggestedSlots(ctx context.Context) int {
+	info, err := e.client.Info(ctx)
+	if err != nil || info.NCPU <= 0 || info.MemTotal <= 0 {
+		log.Printf("⚠️  Warning: could not read Docker host resources, using 1 execution slot: %v", err)
+		return 1
+	}
+
+	byCPU := int(float64(info.NCPU) / e.dockerConfig.CompileCPULimit)
+	byMemory := int(info.MemTotal / (e.dockerConfig.CompileMemoryMB * 1024 * 1024))
+
+	slots := byCPU
+	if byMemory < slots {
+		slots = byMemory
+	}
+	if slots < 1 {
+		slots = 1
+	}
+	return slots
+}
@@ -1,51 +1,166 @@
 package docker
 
 import (
+	"archive/tar"
+	"bytes"
+	"context"
 	"fmt"
 	"log"
-	"os"
-	"path/filepath"
-	"runtime"
+	"path"
+	"strings"
+	"time"
+
+	"github.com/docker/docker/api/types/container"
+	"github.com/docker/docker/pkg/stdcopy"
+	"go.opentelemetry.io/otel/attribute"
+	"go.opentelemetry.io/otel/trace"
+
+	"code-runner/internal/tracing"
 )
 
-// setupExecutionDirectory crea y configura el directorio de ejecución
-func (e *DockerExecutor) setupExecutionDirectory(config *ExecutionConfig) (string, error) {
-	cwd, err := os.Getwd()
+// coderunnerUID es el UID/GID del usuario coderunner dentro de la imagen
+const coderunnerUID = 1000
+
+const (
+	// fileTransferTimeout acota la copia de archivos hacia y desde el contenedor
+	fileTransferTimeout = 30 * time.Second
+
+	// maxTransferErrorBytes acota el stderr retenido de tar/cat para el mensaje de error
+	maxTransferErrorBytes = 4 * 1024
+)
+
+// workspaceFile es un archivo a copiar al directorio de trabajo de la ejecución
+type workspaceFile struct {
+	Name string
+	Data []byte
+	Mode int64
+}
+
+// copyWorkspaceToContainer crea el directorio de trabajo de la ejecución dentro del
+// contenedor y copia los archivos dados, sin pasar por el filesystem del servicio.
+// El workspace es un tmpfs del contenedor, que la API de copia de Docker no ve, así que
+// el tar se envía por el stdin de un tar -x que corre como el usuario de la imagen.
+func (e *DockerExecutor) copyWorkspaceToContainer(ctx context.Context, containerID, workDir string, files []workspaceFile) error {
+	archive, err := buildWorkspaceArchive(path.Base(workDir), files)
 	if err != nil {
-		return "", fmt.Errorf("failed to get current directory: %w", err)
+		return fmt.Errorf("failed to build workspace archive: %w", err)
 	}
+	size := archive.Len()
 
-	baseDir := filepath.Join(cwd, "compiled_test_codes")
-	executionDir := filepath.Join(baseDir, config.ExecutionID.String())
+	command := []string{"tar", "-x", "--no-same-owner", "-C", path.Dir(workDir)}
+	ctx, span := tracing.Start(ctx, "copyWorkspace", trace.WithAttributes(attribute.Int("coderunner.archive_bytes", size)))
+	_, err = e.execWithInput(ctx, containerID, "", command, archive.Bytes(), 0)
+	tracing.End(span, err)
+	if err != nil {
+		return fmt.Errorf("failed to copy workspace to container: %w", err)
+	}
+
+	log.Printf("  💾 Workspace copied to %s (%d bytes)", workDir, size)
+	return nil
+}
 
-	// Create directory with write permissions
-	if err := os.MkdirAll(executionDir, 0777); err != nil {
-		return "", fmt.Errorf("failed to create execution directory: %w", err)
+// readFileFromContainer lee un archivo del contenedor (como root, para alcanzar el
+// directorio de measure). Si maxBytes es mayor que cero, falla en lugar de leer
+// archivos más grandes.
+func (e *DockerExecutor) readFileFromContainer(ctx context.Context, containerID, filePath string, maxBytes int64) ([]byte, error) {
+	data, err := e.execWithInput(ctx, containerID, "root", []string{"cat", "--", filePath}, nil, maxBytes)
+	if err != nil {
+		return nil, fmt.Errorf("failed to read %s from container: %w", filePath, err)
 	}
+	return data, nil
+}
 
-	// Change ownership to coderunner user (UID 1000) on Linux/macOS
-	if runtime.GOOS != "windows" {
-		if err := os.Chown(executionDir, 1000, 1000); err != nil {
-			log.Printf("  ⚠️  Warning: failed to chown directory: %v", err)
-		}
+// execWithInput ejecuta cmd en el contenedor como user (o el usuario de la imagen si está
+// vacío), le envía stdin si no es nil y retorna su stdout, acotado a maxBytes (0 = sin
+// límite). Falla si el comando no termina con exit code 0.
+func (e *DockerExecutor) execWithInput(ctx context.Context, containerID, user string, cmd []string, stdin []byte, maxBytes int64) ([]byte, error) {
+	execCtx, cancel := context.WithTimeout(ctx, fileTransferTimeout)
+	defer cancel()
+
+	execResp, err := e.client.ContainerExecCreate(execCtx, containerID, container.ExecOptions{
+		Cmd:          cmd,
+		User:         user,
+		AttachStdin:  stdin != nil,
+		AttachStdout: true,
+		AttachStderr: true,
+	})
+	if err != nil {
+		return nil, fmt.Errorf("failed to create exec: %w", err)
 	}
 
-	log.Printf("  📁 Execution directory created: %s", executionDir)
+	attach, err := e.client.ContainerExecAttach(execCtx, execResp.ID, container.ExecAttachOptions{})
+	if err != nil {
+		return nil, fmt.Errorf("failed to attach to exec: %w", err)
+	}
+	defer attach.Close()
 
-	// Save source code
-	sourceFile := filepath.Join(executionDir, "solution.cpp")
-	if err := os.WriteFile(sourceFile, []byte(config.SourceCode), 0666); err != nil {
-		return "", fmt.Errorf("failed to write source file: %w", err)
+	// stdin is written while the output is read so neither side blocks on a full pipe
+	if stdin != nil {
+		go func() {
+			attach.Conn.Write(stdin)
+			attach.CloseWrite()
+		}()
 	}
 
-	// Change ownership of source file
-	if runtime.GOOS != "windows" {
-		if err := os.Chown(sourceFile, 1000, 1000); err != nil {
-			log.Printf("  ⚠️  Warning: failed to chown source file: %v", err)
-		}
+	// Going over maxBytes closes the connection, which ends the copy below
+	limiter := newOutputLimiter(maxBytes, attach.Close)
+	stdout := limiter.buffer()
+	stderr := newOutputLimiter(maxTransferErrorBytes, nil).buffer()
+	_, copyErr := stdcopy.StdCopy(stdout, stderr, attach.Reader)
+	if limiter.Exceeded() {
+		return nil, fmt.Errorf("output exceeds %d bytes", maxBytes)
+	}
+	if copyErr != nil {
+		return nil, fmt.Errorf("failed to read exec output: %w", copyErr)
+	}
+
+	exitCode, err := e.waitExecExit(execCtx, execResp.ID)
+	if err != nil {
+		return nil, err
+	}
+	if exitCode != 0 {
+		return nil, fmt.Errorf("%s exited with code %d: %s", cmd[0], exitCode, strings.TrimSpace(stderr.String()))
+	}
+	return stdout.Bytes(), nil
+}
+
+// buildWorkspaceArchive genera un tar con el directorio dirName y los archivos dados,
+// con el usuario coderunner como dueño
+func buildWorkspaceArchive(dirName string, files []workspaceFile) (*bytes.Buffer, error) {
+	buf := new(bytes.Buffer)
+	tw := tar.NewWriter(buf)
+	now := time.Now()
+
+	if err := tw.WriteHeader(&tar.Header{
+		Typeflag: tar.TypeDir,
+		Name:     dirName + "/",
+		Mode:     0755,
+		Uid:      coderunnerUID,
+		Gid:      coderunnerUID,
+		ModTime:  now,
+	}); err != nil {
+		return nil, err
 	}
 
-	log.Printf("  💾 Source code saved: %s (%d bytes)", sourceFile, len(config.SourceCode))
+	for _, file := range files {
+		if err := tw.WriteHeader(&tar.Header{
+			Typeflag: tar.TypeReg,
+			Name:     path.Join(dirName, file.Name),
+			Mode:     file.Mode,
+			Size:     int64(len(file.Data)),
+			Uid:      coderunnerUID,
+			Gid:      coderunnerUID,
+			ModTime:  now,
+		}); err != nil {
+			return nil, err
+		}
+		if _, err := tw.Write(file.Data); err != nil {
+			return nil, err
+		}
+	}
 
-	return executionDir, nil
+	if err := tw.Close(); err != nil {
+		return nil, err
+	}
+	return buf, nil
 }
@@ -10,9 +10,15 @@ import (
 	"os"
 	"path/filepath"
 	"strings"
+	"time"
 
 	"github.com/docker/docker/api/types"
 	"github.com/docker/docker/client"
+	"go.opentelemetry.io/otel/attribute"
+	"go.opentelemetry.io/otel/trace"
+
+	"code-runner/internal/metrics"
+	"code-runner/internal/tracing"
 )
 
 // EnsureImagesReady verifica que todas las imágenes necesarias existen y las construye si faltan
@@ -44,18 +50,28 @@ func (e *DockerExecutor) EnsureImagesReady(ctx context.Context) error {
 	return nil
 }
 
-// ensureImage verifica que la imagen existe, si no la construye
-func (e *DockerExecutor) ensureImage(ctx context.Context, imageName string) error {
-	_, _, err := e.client.ImageInspectWithRaw(ctx, imageName)
+// ensureImage verifica que la imagen existe (si no la construye) y retorna su ID
+func (e *DockerExecutor) ensureImage(ctx context.Context, imageName string) (imageID string, err error) {
+	defer metrics.ObserveStage(metrics.StageImageCheck, time.Now())
+	ctx, span := tracing.Start(ctx, "ensureImage", trace.WithAttributes(attribute.String("coderunner.image", imageName)))
+	defer func() { tracing.End(span, err) }()
+
+	inspect, _, err := e.client.ImageInspectWithRaw(ctx, imageName)
 	if err != nil {
-		if client.IsErrNotFound(err) {
-			log.Printf("  ⚠️  Image %s not found, building...", imageName)
-			return e.BuildImage(ctx, "cpp")
+		if !client.IsErrNotFound(err) {
+			return "", fmt.Errorf("failed to inspect image: %w", err)
+		}
+
+		log.Printf("  ⚠️  Image %s not found, building...", imageName)
+		if err := e.BuildImage(ctx, "cpp"); err != nil {
+			return "", err
+		}
+		if inspect, _, err = e.client.ImageInspectWithRaw(ctx, imageName); err != nil {
+			return "", fmt.Errorf("failed to inspect image: %w", err)
 		}
-		return fmt.Errorf("failed to inspect image: %w", err)
 	}
 	log.Printf("  ✅ Image %s found", imageName)
-	return nil
+	return inspect.ID, nil
 }
 
 // BuildImage construye la imagen Docker para un lenguaje específico
@@ -1,7 +1,6 @@
 package docker
 
 import (
-	"fmt"
 	"log"
 )
 
@@ -10,26 +9,30 @@ func (e *DockerExecutor) logExecutionResults(result *ExecutionResult) {
 	log.Printf("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━")
 	log.Printf("📊 EXECUTION COMPLETED")
 	log.Printf("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━")
-	log.Printf("   ⏱️  Duration: %dms", result.ExecutionTimeMS)
+	log.Printf("   ⏱️  Duration: %dms (compile: %dms, run: %dms)", result.ExecutionTimeMS, result.CompilationTimeMS, result.RunTimeMS)
+	log.Printf("   🧮 Solution: %.2f MB peak, cpu %dms user + %dms sys, wall %dms", result.MemoryUsageMB, result.CPUUserMS, result.CPUSystemMS, result.WallTimeMS)
 	log.Printf("   📊 Exit code: %d", result.ExitCode)
 	log.Printf("   📝 Stdout length: %d bytes", len(result.StdOut))
 	log.Printf("   📝 Stderr length: %d bytes", len(result.StdErr))
 
+	if len(result.CompilationLog) > 0 {
+		log.Printf("\n🔨 COMPILATION LOG:")
+		log.Printf("─────────────────────────────────────────────────────")
+		log.Printf("%s", outputPreview(result.CompilationLog))
+		log.Printf("─────────────────────────────────────────────────────")
+	}
+
 	if len(result.StdOut) > 0 {
 		log.Printf("\n💬 STDOUT OUTPUT:")
 		log.Printf("─────────────────────────────────────────────────────")
-		stdoutPreview := result.StdOut
-		if len(stdoutPreview) > 1000 {
-			stdoutPreview = stdoutPreview[:1000] + fmt.Sprintf("\n... (truncated, total: %d bytes)", len(result.StdOut))
-		}
-		log.Printf("%s", stdoutPreview)
+		log.Printf("%s", outputPreview(result.StdOut))
 		log.Printf("─────────────────────────────────────────────────────")
 	}
 
 	if len(result.StdErr) > 0 {
 		log.Printf("\n⚠️  STDERR OUTPUT:")
 		log.Printf("─────────────────────────────────────────────────────")
-		log.Printf("%s", result.StdErr)
+		log.Printf("%s", outputPreview(result.StdErr))
 		log.Printf("─────────────────────────────────────────────────────")
 	}
 
@@ -0,0 +1,369 @@
+//go:build linux && (amd64 || arm64)
+
+package docker
+
+import (
+	"context"
+	"fmt"
+	"io"
+	"log"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"strconv"
+	"strings"
+	"syscall"
+	"time"
+
+	"go.opentelemetry.io/otel/attribute"
+	"go.opentelemetry.io/otel/trace"
+
+	"code-runner/internal/metrics"
+	"code-runner/internal/tracing"
+)
+
+// nativeCompileFlags agrega -static a los flags de compilación: el binario corre en el
+// host, fuera de la imagen, y no puede depender de sus bibliotecas compartidas
+const nativeCompileFlags = "-static"
+
+// NativeExecutor implementa Executor compilando en Docker y ejecutando el binario
+// directamente en el host, aislado con namespaces, cgroups v2, seccomp y rlimits.
+// Evita el costo de docker exec en la fase de ejecución.
+type NativeExecutor struct {
+	docker *DockerExecutor
+	config *NativeConfig
+}
+
+// NewNativeExecutor crea un NativeExecutor que usa dockerExecutor para compilar.
+// Requiere correr como root en un host con cgroups v2.
+func NewNativeExecutor(dockerExecutor *DockerExecutor, config *NativeConfig) (*NativeExecutor, error) {
+	if os.Geteuid() != 0 {
+		return nil, fmt.Errorf("native executor requires root privileges")
+	}
+
+	if err := os.MkdirAll(config.WorkDir, 0755); err != nil {
+		return nil, fmt.Errorf("failed to create native work directory: %w", err)
+	}
+	if err := mountNativeWorkDir(config); err != nil {
+		return nil, err
+	}
+
+	if err := os.MkdirAll(config.CgroupRoot, 0755); err != nil {
+		return nil, fmt.Errorf("failed to create cgroup %s: %w", config.CgroupRoot, err)
+	}
+	if err := writeCgroupFile(config.CgroupRoot, "cgroup.subtree_control", "+memory +cpu +pids"); err != nil {
+		return nil, fmt.Errorf("failed to enable cgroup controllers (is cgroup v2 delegated?): %w", err)
+	}
+
+	log.Printf("🪶 Native executor ready (workdir: %s, cgroup: %s, uid: %d)", config.WorkDir, config.CgroupRoot, config.UID)
+	return &NativeExecutor{docker: dockerExecutor, config: config}, nil
+}
+
+// Execute compila la solución en Docker (o la toma del cache) y la ejecuta en el sandbox nativo
+func (n *NativeExecutor) Execute(ctx context.Context, config *ExecutionConfig) (*ExecutionResult, error) {
+	startTime := time.Now()
+	log.Printf("🪶 Starting native execution for ExecutionID: %s", config.ExecutionID)
+
+	// The sanitizer runtimes cannot be linked statically: run those in a container
+	if config.Compiler.Sanitizers {
+		log.Printf("  🧪 Sanitizers requested, delegating execution to Docker")
+		return n.docker.Execute(ctx, config)
+	}
+
+	// Phase 1: compilation (in Docker, where the toolchain lives)
+	binary, result, err := n.docker.CompileBinary(ctx, config, nativeCompileFlags)
+	if err != nil {
+		return nil, err
+	}
+	if binary == nil {
+		result.ExecutionTimeMS = time.Since(startTime).Milliseconds()
+		n.docker.logExecutionResults(result)
+		return result, nil
+	}
+
+	// Phase 2: execution (native sandbox)
+	config.emitProgress(ProgressEvent{Phase: PhaseRunning})
+	runStart := time.Now()
+	runCtx, runSpan := tracing.Start(ctx, "run", trace.WithAttributes(attribute.Int("coderunner.tests", len(config.TestIDs))))
+	output, err := n.runSandboxed(runCtx, config, binary, result)
+	result.RunTimeMS = time.Since(runStart).Milliseconds()
+	metrics.ObserveStage(metrics.StageRun, runStart)
+	tracing.End(runSpan, err)
+	if err != nil {
+		return nil, err
+	}
+
+	if output.OutputLimitExceeded {
+		applyOutputLimitExceeded(result, output, n.docker.dockerConfig.MaxOutputBytes, "Execution")
+		result.ExecutionTimeMS = time.Since(startTime).Milliseconds()
+		n.docker.logExecutionResults(result)
+		return result, nil
+	}
+
+	if output.TimedOut {
+		result.ExecutionTimeMS = time.Since(startTime).Milliseconds()
+		n.docker.buildTimedOutResult(result, output, config)
+		return result, nil
+	}
+
+	result.ExecutionTimeMS = time.Since(startTime).Milliseconds()
+	_, parseSpan := tracing.Start(ctx, "parse")
+	n.docker.buildRunResult(result, output, config)
+	parseSpan.End()
+	return result, nil
+}
+
+// BuildImage construye la imagen de compilación
+func (n *NativeExecutor) BuildImage(ctx context.Context, language string) error {
+	return n.docker.BuildImage(ctx, language)
+}
+
+// Cleanup elimina un contenedor de compilación
+func (n *NativeExecutor) Cleanup(ctx context.Context, containerID string) error {
+	return n.docker.Cleanup(ctx, containerID)
+}
+
+// EnsureImagesReady verifica que la imagen de compilación exista
+func (n *NativeExecutor) EnsureImagesReady(ctx context.Context) error {
+	return n.docker.EnsureImagesReady(ctx)
+}
+
+// runSandboxed ejecuta el binario en un workspace propio del host, dentro de un cgroup
+// propio y de nuevos namespaces (mount, pid, red, ipc, uts). El proceso re-ejecuta el
+// servicio como sandbox init (ver executor_native_init.go), que termina de aislarlo y
+// hace exec de la solución. El consumo de la solución que reporta el init se copia a result.
+func (n *NativeExecutor) runSandboxed(ctx context.Context, config *ExecutionConfig, binary []byte, result *ExecutionResult) (*commandOutput, error) {
+	workspace := filepath.Join(n.config.WorkDir, config.ExecutionID.String())
+	if err := prepareNativeWorkspace(workspace, binary); err != nil {
+		return nil, err
+	}
+	defer os.RemoveAll(workspace)
+
+	cgroupDir := filepath.Join(n.config.CgroupRoot, config.ExecutionID.String())
+	if err := n.createCgroup(cgroupDir, config); err != nil {
+		return nil, err
+	}
+	defer removeCgroup(cgroupDir)
+
+	cgroupFD, err := os.Open(cgroupDir)
+	if err != nil {
+		return nil, fmt.Errorf("failed to open cgroup: %w", err)
+	}
+	defer cgroupFD.Close()
+
+	statsReader, statsWriter, err := os.Pipe()
+	if err != nil {
+		return nil, fmt.Errorf("failed to create stats pipe: %w", err)
+	}
+	defer statsReader.Close()
+
+	reportReader, reportWriter, err := os.Pipe()
+	if err != nil {
+		statsWriter.Close()
+		return nil, fmt.Errorf("failed to create report pipe: %w", err)
+	}
+	defer reportReader.Close()
+
+	// Output is consumed while the solution runs; going over the cap kills it early
+	outputExceeded := make(chan struct{})
+	limiter := newOutputLimiter(n.docker.dockerConfig.MaxOutputBytes, func() { close(outputExceeded) })
+	stdout, stderr := limiter.buffer(), limiter.buffer()
+	var stdoutWriter io.Writer = stdout
+	if tap := newProgressWriter(config); tap != nil {
+		stdoutWriter = io.MultiWriter(stdout, tap)
+	}
+	cmd := &exec.Cmd{
+		Path: "/proc/self/exe",
+		Args: append([]string{
+			nativeInitArg,
+			workspace,
+			strconv.Itoa(config.TimeoutSeconds),
+			strconv.Itoa(n.config.UID),
+			strconv.Itoa(n.config.GID),
+		}, n.docker.harnessArgs(config)...),
+		Env:        []string{"PATH=/", "HOME=/tmp", "TMPDIR=/tmp", "CODERUNNER_REPORT_FD=3"},
+		Stdout:     stdoutWriter,
+		Stderr:     stderr,
+		ExtraFiles: []*os.File{statsWriter, reportWriter},
+		SysProcAttr: &syscall.SysProcAttr{
+			Cloneflags: syscall.CLONE_NEWNS | syscall.CLONE_NEWPID | syscall.CLONE_NEWNET |
+				syscall.CLONE_NEWIPC | syscall.CLONE_NEWUTS,
+			UseCgroupFD: true,
+			CgroupFD:    int(cgroupFD.Fd()),
+			Pdeathsig:   syscall.SIGKILL,
+		},
+	}
+
+	err = cmd.Start()
+	statsWriter.Close()
+	reportWriter.Close()
+	if err != nil {
+		return nil, fmt.Errorf("failed to start sandbox: %w", err)
+	}
+	log.Printf("  🚀 Sandbox started (pid %d)", cmd.Process.Pid)
+
+	// The report is read while the solution runs so it never blocks on a full pipe
+	reportDone := make(chan []byte, 1)
+	go func() {
+		reportDone <- readCapped(reportReader, maxTestReportBytes)
+	}()
+
+	waitDone := make(chan error, 1)
+	go func() {
+		waitDone <- cmd.Wait()
+	}()
+
+	timer := time.NewTimer(time.Duration(config.TimeoutSeconds) * time.Second)
+	defer timer.Stop()
+
+	select {
+	case <-waitDone:
+	case <-timer.C:
+		killCgroup(cgroupDir, cmd.Process)
+		<-waitDone
+		// Everything in the cgroup is dead, so the report pipe is at EOF
+		return &commandOutput{TimedOut: true, StdOut: stdout.String(), StdErr: stderr.String(), Report: <-reportDone}, nil
+	case <-ctx.Done():
+		// Cancelled by the caller (or the service shutting down): not the solution's timeout
+		killCgroup(cgroupDir, cmd.Process)
+		<-waitDone
+		return nil, ctx.Err()
+	case <-outputExceeded:
+		killCgroup(cgroupDir, cmd.Process)
+		<-waitDone
+		log.Printf("  📛 Output limit exceeded (%d bytes), sandbox killed", n.docker.dockerConfig.MaxOutputBytes)
+		return &commandOutput{OutputLimitExceeded: true, StdOut: stdout.String(), StdErr: stderr.String()}, nil
+	}
+
+	exitCode := nativeExitCode(cmd.ProcessState)
+	if exitCode == nativeInitFailureCode && strings.HasPrefix(stderr.String(), nativeInitErrorPrefix) {
+		return nil, fmt.Errorf("failed to set up sandbox: %s", strings.TrimSpace(stderr.String()))
+	}
+
+	// The init closed its end of the pipe when it exited
+	if data, err := io.ReadAll(statsReader); err == nil {
+		if stats, err := parseProcessStats(data); err == nil {
+			stats.apply(result)
+		}
+	}
+
+	log.Printf("  ✅ Command finished with exit code: %d", exitCode)
+	return &commandOutput{
+		ExitCode: exitCode,
+		StdOut:   stdout.String(),
+		StdErr:   stderr.String(),
+		Report:   <-reportDone,
+	}, nil
+}
+
+// readCapped lee r hasta EOF y retorna a lo sumo maxBytes; si r produce más, el reporte
+// se descarta (nil) pero se sigue drenando para no bloquear al escritor
+func readCapped(r io.Reader, maxBytes int64) []byte {
+	data, err := io.ReadAll(io.LimitReader(r, maxBytes+1))
+	if err != nil || int64(len(data)) > maxBytes {
+		io.Copy(io.Discard, r)
+		return nil
+	}
+	return data
+}
+
+// createCgroup crea el cgroup de la ejecución con sus límites de memoria, CPU y procesos
+func (n *NativeExecutor) createCgroup(cgroupDir string, config *ExecutionConfig) error {
+	if err := os.Mkdir(cgroupDir, 0755); err != nil {
+		return fmt.Errorf("failed to create cgroup: %w", err)
+	}
+
+	const cpuPeriod = 100000
+	limits := []struct{ file, value string }{
+		{"memory.max", strconv.FormatInt(config.MemoryLimitMB*1024*1024, 10)},
+		{"memory.swap.max", "0"},
+		{"cpu.max", fmt.Sprintf("%d %d", int64(config.CPULimit*cpuPeriod), cpuPeriod)},
+		{"pids.max", strconv.FormatInt(n.config.PidsLimit, 10)},
+	}
+	for _, limit := range limits {
+		if err := writeCgroupFile(cgroupDir, limit.file, limit.value); err != nil {
+			removeCgroup(cgroupDir)
+			return fmt.Errorf("failed to set %s: %w", limit.file, err)
+		}
+	}
+	return nil
+}
+
+// tmpfsMagic es el f_type que statfs reporta para un tmpfs
+const tmpfsMagic = 0x01021994
+
+// mountNativeWorkDir deja WorkDir en memoria: si no es ya un tmpfs, monta uno del tamaño
+// configurado. Los workspaces que quedaron de una corrida anterior (por ejemplo, si el
+// servicio murió a mitad de una ejecución) se borran.
+func mountNativeWorkDir(config *NativeConfig) error {
+	var fs syscall.Statfs_t
+	if err := syscall.Statfs(config.WorkDir, &fs); err != nil {
+		return fmt.Errorf("failed to stat native work directory: %w", err)
+	}
+
+	if fs.Type != tmpfsMagic {
+		// exec must stay allowed: the solution binary runs from the workspace
+		options := fmt.Sprintf("size=%dm,mode=0755", config.WorkspaceTmpfsMB)
+		if err := syscall.Mount("tmpfs", config.WorkDir, "tmpfs", syscall.MS_NOSUID|syscall.MS_NODEV, options); err != nil {
+			return fmt.Errorf("failed to mount tmpfs on %s: %w", config.WorkDir, err)
+		}
+		log.Printf("  💾 Mounted %dMB tmpfs on %s", config.WorkspaceTmpfsMB, config.WorkDir)
+	}
+
+	entries, err := os.ReadDir(config.WorkDir)
+	if err != nil {
+		return fmt.Errorf("failed to read native work directory: %w", err)
+	}
+	for _, entry := range entries {
+		os.RemoveAll(filepath.Join(config.WorkDir, entry.Name()))
+	}
+	if len(entries) > 0 {
+		log.Printf("  🧹 Removed %d stale native workspaces", len(entries))
+	}
+	return nil
+}
+
+// prepareNativeWorkspace crea el directorio que será la raíz (de solo lectura) del sandbox
+func prepareNativeWorkspace(workspace string, binary []byte) error {
+	if err := os.MkdirAll(filepath.Join(workspace, "tmp"), 0755); err != nil {
+		return fmt.Errorf("failed to create native workspace: %w", err)
+	}
+	if err := os.WriteFile(filepath.Join(workspace, "solution"), binary, 0755); err != nil {
+		os.RemoveAll(workspace)
+		return fmt.Errorf("failed to write solution binary: %w", err)
+	}
+	return nil
+}
+
+// killCgroup mata todos los procesos del cgroup (y el proceso principal como respaldo)
+func killCgroup(cgroupDir string, process *os.Process) {
+	if err := writeCgroupFile(cgroupDir, "cgroup.kill", "1"); err != nil {
+		process.Kill()
+	}
+}
+
+// removeCgroup elimina el cgroup de la ejecución una vez que quedó vacío
+func removeCgroup(cgroupDir string) {
+	for i := 0; i < 50; i++ {
+		if err := os.Remove(cgroupDir); err == nil || os.IsNotExist(err) {
+			return
+		}
+		writeCgroupFile(cgroupDir, "cgroup.kill", "1")
+		time.Sleep(10 * time.Millisecond)
+	}
+	log.Printf("  ⚠️  Warning: failed to remove cgroup %s", cgroupDir)
+}
+
+// writeCgroupFile escribe un valor en un archivo de control del cgroup
+func writeCgroupFile(cgroupDir, file, value string) error {
+	return os.WriteFile(filepath.Join(cgroupDir, file), []byte(value), 0644)
+}
+
+// nativeExitCode traduce el estado del proceso a un exit code con la misma convención
+// que Docker (128+señal si el proceso murió por una señal)
+func nativeExitCode(state *os.ProcessState) int {
+	if status, ok := state.Sys().(syscall.WaitStatus); ok && status.Signaled() {
+		return 128 + int(status.Signal())
+	}
+	return state.ExitCode()
+}
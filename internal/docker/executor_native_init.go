@@ -0,0 +1,286 @@
+//go:build linux && (amd64 || arm64)
+
+package docker
+
+import (
+	"fmt"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"runtime"
+	"strconv"
+	"syscall"
+	"time"
+	"unsafe"
+)
+
+const (
+	// nativeInitArg es el argv[0] con el que el servicio se re-ejecuta como sandbox init
+	// (PID 1 de los namespaces nuevos); nativeExecArg es el proceso que hace exec de la solución
+	nativeInitArg = "coderunner-sandbox-init"
+	nativeExecArg = "coderunner-sandbox-exec"
+
+	// nativeStatsFD es el descriptor (ExtraFiles[0]) por el que el sandbox init reporta
+	// al servicio el consumo de la solución; nativeReportFD (ExtraFiles[1]) es el reporte
+	// de tests del harness, que la solución recibe como fd 3 (CODERUNNER_REPORT_FD)
+	nativeStatsFD  = 3
+	nativeReportFD = 4
+
+	// nativeInitFailureCode y nativeInitErrorPrefix identifican errores del sandbox init
+	// (no de la solución), igual que el exit code 125 de docker run
+	nativeInitFailureCode = 125
+	nativeInitErrorPrefix = "coderunner-sandbox-init:"
+)
+
+// Constantes de prctl/seccomp que no expone el paquete syscall
+const (
+	prSetNoNewPrivs       = 38
+	prSetSeccomp          = 22
+	seccompModeFilter     = 2
+	seccompRetKillProcess = 0x80000000
+	seccompRetErrno       = 0x00050000
+	seccompRetAllow       = 0x7fff0000
+	seccompDataNrOffset   = 0
+	seccompDataArchOffset = 4
+	seccompDataArg0Offset = 16 // Mitad baja de args[0] (little endian)
+
+	// clone3 tiene el mismo número en todas las arquitecturas
+	sysClone3 = 435
+)
+
+// seccompCloneNamespaceFlags son los flags de clone que crean namespaces; con ellos clone
+// equivale a unshare. CLONE_NEWTIME solo existe en clone3 (en clone es parte de CSIGNAL).
+const seccompCloneNamespaceFlags = syscall.CLONE_NEWNS | syscall.CLONE_NEWCGROUP | syscall.CLONE_NEWUTS |
+	syscall.CLONE_NEWIPC | syscall.CLONE_NEWUSER | syscall.CLONE_NEWPID | syscall.CLONE_NEWNET
+
+// Límites del sandbox que no dependen de la ejecución
+const (
+	sandboxTmpfsOptions    = "size=16m,mode=1777"
+	sandboxOpenFilesLimit  = 64
+	sandboxFileSizeLimitMB = 16
+)
+
+func init() {
+	if len(os.Args) == 0 || (os.Args[0] != nativeInitArg && os.Args[0] != nativeExecArg) {
+		return
+	}
+
+	// Credentials and seccomp apply to the thread that calls execve
+	runtime.LockOSThread()
+
+	var err error
+	if os.Args[0] == nativeInitArg {
+		var exitCode int
+		if exitCode, err = runSandboxInit(os.Args[1:]); err == nil {
+			os.Exit(exitCode)
+		}
+	} else {
+		err = runSandboxExec(os.Args[1:])
+	}
+
+	fmt.Fprintf(os.Stderr, "%s %v\n", nativeInitErrorPrefix, err)
+	os.Exit(nativeInitFailureCode)
+}
+
+// runSandboxInit corre como PID 1 de los namespaces nuevos creados por NativeExecutor:
+// deja el workspace de solo lectura con un /tmp en tmpfs, lanza la solución como hijo
+// (un PID 1 ignoraría las señales sin handler, como el SIGABRT de abort()) y retorna su
+// exit code con la convención 128+señal. El consumo de la solución (rusage de wait4) se
+// escribe en nativeStatsFD.
+func runSandboxInit(args []string) (int, error) {
+	if len(args) < 4 {
+		return 0, fmt.Errorf("expected at least 4 arguments, got %d", len(args))
+	}
+	workspace := args[0]
+
+	// Only the report reaches the solution, explicitly as fd 3
+	syscall.CloseOnExec(nativeStatsFD)
+	statsPipe := os.NewFile(nativeStatsFD, "stats")
+	syscall.CloseOnExec(nativeReportFD)
+	reportPipe := os.NewFile(nativeReportFD, "report")
+
+	if err := mountSandboxFilesystem(workspace); err != nil {
+		return 0, err
+	}
+
+	cmd := &exec.Cmd{
+		Path:       "/proc/self/exe",
+		Args:       append([]string{nativeExecArg}, args...),
+		Env:        os.Environ(),
+		Stdout:     os.Stdout,
+		Stderr:     os.Stderr,
+		ExtraFiles: []*os.File{reportPipe},
+	}
+	start := time.Now()
+	if err := cmd.Start(); err != nil {
+		return 0, fmt.Errorf("failed to start solution: %w", err)
+	}
+	reportPipe.Close()
+	cmd.Wait()
+	wall := time.Since(start)
+
+	if usage, ok := cmd.ProcessState.SysUsage().(*syscall.Rusage); ok {
+		stats := &processStats{
+			PeakRSSKB: usage.Maxrss,
+			UserMS:    cmd.ProcessState.UserTime().Milliseconds(),
+			SysMS:     cmd.ProcessState.SystemTime().Milliseconds(),
+			WallMS:    wall.Milliseconds(),
+		}
+		statsPipe.WriteString(formatProcessStats(stats))
+	}
+	statsPipe.Close()
+
+	return nativeExitCode(cmd.ProcessState), nil
+}
+
+// mountSandboxFilesystem hace privados los mounts, remonta el workspace de solo lectura
+// y monta un tmpfs acotado en su /tmp
+func mountSandboxFilesystem(workspace string) error {
+	if err := syscall.Mount("", "/", "", syscall.MS_REC|syscall.MS_PRIVATE, ""); err != nil {
+		return fmt.Errorf("failed to make mounts private: %w", err)
+	}
+	if err := syscall.Mount(workspace, workspace, "", syscall.MS_BIND|syscall.MS_REC, ""); err != nil {
+		return fmt.Errorf("failed to bind workspace: %w", err)
+	}
+	if err := syscall.Mount("", workspace, "", syscall.MS_BIND|syscall.MS_REMOUNT|syscall.MS_RDONLY|syscall.MS_NOSUID|syscall.MS_NODEV, ""); err != nil {
+		return fmt.Errorf("failed to remount workspace read-only: %w", err)
+	}
+	if err := syscall.Mount("tmpfs", filepath.Join(workspace, "tmp"), "tmpfs", syscall.MS_NOSUID|syscall.MS_NODEV, sandboxTmpfsOptions); err != nil {
+		return fmt.Errorf("failed to mount /tmp: %w", err)
+	}
+	return nil
+}
+
+// runSandboxExec convierte el workspace en la raíz, aplica rlimits, baja a UID/GID sin
+// privilegios, instala el filtro seccomp y hace exec de la solución. Solo retorna si algo falla.
+func runSandboxExec(args []string) error {
+	if len(args) < 4 {
+		return fmt.Errorf("expected at least 4 arguments, got %d", len(args))
+	}
+	workspace := args[0]
+	timeoutSeconds, err := strconv.ParseUint(args[1], 10, 64)
+	if err != nil {
+		return fmt.Errorf("invalid timeout: %w", err)
+	}
+	uid, err := strconv.Atoi(args[2])
+	if err != nil {
+		return fmt.Errorf("invalid uid: %w", err)
+	}
+	gid, err := strconv.Atoi(args[3])
+	if err != nil {
+		return fmt.Errorf("invalid gid: %w", err)
+	}
+
+	if err := syscall.Chroot(workspace); err != nil {
+		return fmt.Errorf("failed to chroot: %w", err)
+	}
+	if err := syscall.Chdir("/"); err != nil {
+		return fmt.Errorf("failed to chdir: %w", err)
+	}
+
+	// Resource limits not covered by the cgroup
+	rlimits := []struct {
+		resource int
+		value    uint64
+	}{
+		{syscall.RLIMIT_CPU, timeoutSeconds + 1},
+		{syscall.RLIMIT_FSIZE, sandboxFileSizeLimitMB * 1024 * 1024},
+		{syscall.RLIMIT_NOFILE, sandboxOpenFilesLimit},
+		{syscall.RLIMIT_CORE, 0},
+	}
+	for _, rl := range rlimits {
+		if err := syscall.Setrlimit(rl.resource, &syscall.Rlimit{Cur: rl.value, Max: rl.value}); err != nil {
+			return fmt.Errorf("failed to set rlimit %d: %w", rl.resource, err)
+		}
+	}
+
+	// Drop privileges (coderunner user, same UID as in the Docker image)
+	if err := syscall.Setgroups([]int{}); err != nil {
+		return fmt.Errorf("failed to drop supplementary groups: %w", err)
+	}
+	if err := syscall.Setgid(gid); err != nil {
+		return fmt.Errorf("failed to set gid: %w", err)
+	}
+	if err := syscall.Setuid(uid); err != nil {
+		return fmt.Errorf("failed to set uid: %w", err)
+	}
+
+	if _, _, errno := syscall.RawSyscall6(syscall.SYS_PRCTL, prSetNoNewPrivs, 1, 0, 0, 0, 0); errno != 0 {
+		return fmt.Errorf("failed to set no_new_privs: %w", errno)
+	}
+	if err := installSeccompFilter(); err != nil {
+		return err
+	}
+
+	// Remaining arguments are passed to the harness (see harnessArgs)
+	return syscall.Exec("/solution", append([]string{"/solution"}, args[4:]...), os.Environ())
+}
+
+// installSeccompFilter instala un filtro BPF que mata el proceso si usa otra ABI o crea
+// namespaces con clone, y responde EPERM a las syscalls de seccompDeniedSyscalls
+func installSeccompFilter() error {
+	filter := buildSeccompFilter(seccompAuditArch, seccompDeniedSyscalls, seccompRejectFrom)
+	prog := syscall.SockFprog{
+		Len:    uint16(len(filter)),
+		Filter: &filter[0],
+	}
+
+	if _, _, errno := syscall.RawSyscall6(syscall.SYS_PRCTL, prSetSeccomp, seccompModeFilter, uintptr(unsafe.Pointer(&prog)), 0, 0, 0); errno != 0 {
+		return fmt.Errorf("failed to install seccomp filter: %w", errno)
+	}
+	return nil
+}
+
+// buildSeccompFilter genera el programa BPF del filtro seccomp. Si rejectFrom es distinto
+// de cero, también se rechazan los números de syscall mayores o iguales (ABI x32).
+//
+// clone con algún flag CLONE_NEW* mata el proceso, igual que pedir otra ABI: sería
+// unshare por otra vía. clone3 responde ENOSYS, porque sus flags están en una estructura
+// en memoria que BPF no puede leer; libc entonces recurre a clone.
+func buildSeccompFilter(auditArch uint32, denied []uint32, rejectFrom uint32) []syscall.SockFilter {
+	stmt := func(code uint16, k uint32) syscall.SockFilter {
+		return syscall.SockFilter{Code: code, K: k}
+	}
+	jump := func(code uint16, k uint32, jt, jf uint8) syscall.SockFilter {
+		return syscall.SockFilter{Code: code, Jt: jt, Jf: jf, K: k}
+	}
+
+	filter := []syscall.SockFilter{
+		stmt(syscall.BPF_LD|syscall.BPF_W|syscall.BPF_ABS, seccompDataArchOffset),
+		jump(syscall.BPF_JMP|syscall.BPF_JEQ|syscall.BPF_K, auditArch, 1, 0),
+		stmt(syscall.BPF_RET|syscall.BPF_K, seccompRetKillProcess),
+		stmt(syscall.BPF_LD|syscall.BPF_W|syscall.BPF_ABS, seccompDataNrOffset),
+	}
+
+	// After the checks come ALLOW, then the targets a matching check jumps to
+	const (
+		toEPERM = iota + 1
+		toENOSYS
+		toClone
+	)
+	checks := []syscall.SockFilter{
+		jump(syscall.BPF_JMP|syscall.BPF_JEQ|syscall.BPF_K, sysClone3, toENOSYS, 0),
+		jump(syscall.BPF_JMP|syscall.BPF_JEQ|syscall.BPF_K, syscall.SYS_CLONE, toClone, 0),
+	}
+	if rejectFrom != 0 {
+		checks = append(checks, jump(syscall.BPF_JMP|syscall.BPF_JGE|syscall.BPF_K, rejectFrom, toEPERM, 0))
+	}
+	for _, nr := range denied {
+		checks = append(checks, jump(syscall.BPF_JMP|syscall.BPF_JEQ|syscall.BPF_K, nr, toEPERM, 0))
+	}
+	for i := range checks {
+		checks[i].Jt += uint8(len(checks) - i - 1)
+	}
+	filter = append(filter, checks...)
+
+	return append(filter,
+		stmt(syscall.BPF_RET|syscall.BPF_K, seccompRetAllow),
+		stmt(syscall.BPF_RET|syscall.BPF_K, seccompRetErrno|uint32(syscall.EPERM)),
+		stmt(syscall.BPF_RET|syscall.BPF_K, seccompRetErrno|uint32(syscall.ENOSYS)),
+		// clone: kill if the flags ask for a new namespace
+		stmt(syscall.BPF_LD|syscall.BPF_W|syscall.BPF_ABS, seccompDataArg0Offset),
+		jump(syscall.BPF_JMP|syscall.BPF_JSET|syscall.BPF_K, seccompCloneNamespaceFlags, 0, 1),
+		stmt(syscall.BPF_RET|syscall.BPF_K, seccompRetKillProcess),
+		stmt(syscall.BPF_RET|syscall.BPF_K, seccompRetAllow),
+	)
+}
@@ -0,0 +1,37 @@
+//go:build !(linux && (amd64 || arm64))
+
+package docker
+
+import (
+	"context"
+	"fmt"
+	"runtime"
+)
+
+// NativeExecutor no está disponible fuera de Linux amd64/arm64
+type NativeExecutor struct{}
+
+// NewNativeExecutor retorna un error: el sandbox nativo requiere Linux (amd64 o arm64)
+func NewNativeExecutor(dockerExecutor *DockerExecutor, config *NativeConfig) (*NativeExecutor, error) {
+	return nil, fmt.Errorf("native executor is not supported on %s/%s", runtime.GOOS, runtime.GOARCH)
+}
+
+// Execute no está soportado en esta plataforma
+func (n *NativeExecutor) Execute(ctx context.Context, config *ExecutionConfig) (*ExecutionResult, error) {
+	return nil, fmt.Errorf("native executor is not supported on %s/%s", runtime.GOOS, runtime.GOARCH)
+}
+
+// BuildImage no está soportado en esta plataforma
+func (n *NativeExecutor) BuildImage(ctx context.Context, language string) error {
+	return fmt.Errorf("native executor is not supported on %s/%s", runtime.GOOS, runtime.GOARCH)
+}
+
+// Cleanup no está soportado en esta plataforma
+func (n *NativeExecutor) Cleanup(ctx context.Context, containerID string) error {
+	return fmt.Errorf("native executor is not supported on %s/%s", runtime.GOOS, runtime.GOARCH)
+}
+
+// EnsureImagesReady no está soportado en esta plataforma
+func (n *NativeExecutor) EnsureImagesReady(ctx context.Context) error {
+	return fmt.Errorf("native executor is not supported on %s/%s", runtime.GOOS, runtime.GOARCH)
+}
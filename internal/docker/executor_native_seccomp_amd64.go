@@ -0,0 +1,48 @@
+//go:build linux
+
+package docker
+
+import "syscall"
+
+// seccompAuditArch es AUDIT_ARCH_X86_64; cualquier otra ABI (i386) mata el proceso
+const seccompAuditArch = 0xc000003e
+
+// seccompRejectFrom rechaza los números de syscall de la ABI x32 (bit 30)
+const seccompRejectFrom = 0x40000000
+
+// seccompDeniedSyscalls son las syscalls que una solución nunca necesita y que permiten
+// escapar o afectar al host. Los números sin constante en syscall vienen de unistd_64.h.
+var seccompDeniedSyscalls = []uint32{
+	syscall.SYS_PTRACE,
+	syscall.SYS_MOUNT,
+	syscall.SYS_UMOUNT2,
+	syscall.SYS_PIVOT_ROOT,
+	syscall.SYS_CHROOT,
+	syscall.SYS_UNSHARE,
+	308, // setns
+	syscall.SYS_REBOOT,
+	syscall.SYS_KEXEC_LOAD,
+	syscall.SYS_INIT_MODULE,
+	313, // finit_module
+	syscall.SYS_DELETE_MODULE,
+	syscall.SYS_SOCKET,
+	syscall.SYS_KEYCTL,
+	syscall.SYS_ADD_KEY,
+	syscall.SYS_REQUEST_KEY,
+	321, // bpf
+	syscall.SYS_PERF_EVENT_OPEN,
+	syscall.SYS_PERSONALITY,
+	310, // process_vm_readv
+	311, // process_vm_writev
+	312, // kcmp
+	303, // name_to_handle_at
+	304, // open_by_handle_at
+	323, // userfaultfd
+	425, // io_uring_setup
+	syscall.SYS_SWAPON,
+	syscall.SYS_SWAPOFF,
+	syscall.SYS_ACCT,
+	syscall.SYS_SYSLOG,
+	syscall.SYS_SETTIMEOFDAY,
+	syscall.SYS_CLOCK_SETTIME,
+}
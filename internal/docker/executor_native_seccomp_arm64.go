@@ -0,0 +1,48 @@
+//go:build linux
+
+package docker
+
+import "syscall"
+
+// seccompAuditArch es AUDIT_ARCH_AARCH64; cualquier otra ABI (arm32) mata el proceso
+const seccompAuditArch = 0xc00000b7
+
+// seccompRejectFrom no aplica en arm64 (no hay ABI x32)
+const seccompRejectFrom = 0
+
+// seccompDeniedSyscalls son las syscalls que una solución nunca necesita y que permiten
+// escapar o afectar al host. Los números sin constante en syscall vienen de asm-generic/unistd.h.
+var seccompDeniedSyscalls = []uint32{
+	syscall.SYS_PTRACE,
+	syscall.SYS_MOUNT,
+	syscall.SYS_UMOUNT2,
+	syscall.SYS_PIVOT_ROOT,
+	syscall.SYS_CHROOT,
+	syscall.SYS_UNSHARE,
+	syscall.SYS_SETNS,
+	syscall.SYS_REBOOT,
+	syscall.SYS_KEXEC_LOAD,
+	syscall.SYS_INIT_MODULE,
+	syscall.SYS_FINIT_MODULE,
+	syscall.SYS_DELETE_MODULE,
+	syscall.SYS_SOCKET,
+	syscall.SYS_KEYCTL,
+	syscall.SYS_ADD_KEY,
+	syscall.SYS_REQUEST_KEY,
+	syscall.SYS_BPF,
+	syscall.SYS_PERF_EVENT_OPEN,
+	syscall.SYS_PERSONALITY,
+	syscall.SYS_PROCESS_VM_READV,
+	syscall.SYS_PROCESS_VM_WRITEV,
+	syscall.SYS_KCMP,
+	syscall.SYS_NAME_TO_HANDLE_AT,
+	syscall.SYS_OPEN_BY_HANDLE_AT,
+	282, // userfaultfd
+	425, // io_uring_setup
+	syscall.SYS_SWAPON,
+	syscall.SYS_SWAPOFF,
+	syscall.SYS_ACCT,
+	syscall.SYS_SYSLOG,
+	syscall.SYS_SETTIMEOFDAY,
+	syscall.SYS_CLOCK_SETTIME,
+}
@@ -0,0 +1,79 @@
+//go:build linux && (amd64 || arm64)
+
+package docker
+
+import (
+	"encoding/binary"
+	"syscall"
+	"testing"
+)
+
+// runSeccompFilter interpreta el subconjunto de BPF que usa buildSeccompFilter sobre un
+// seccomp_data con la arquitectura, la syscall y el primer argumento dados
+func runSeccompFilter(t *testing.T, filter []syscall.SockFilter, arch, nr uint32, arg0 uint64) uint32 {
+	t.Helper()
+	data := make([]byte, 64)
+	binary.LittleEndian.PutUint32(data[seccompDataNrOffset:], nr)
+	binary.LittleEndian.PutUint32(data[seccompDataArchOffset:], arch)
+	binary.LittleEndian.PutUint64(data[seccompDataArg0Offset:], arg0)
+
+	var acc uint32
+	for pc := 0; pc < len(filter); pc++ {
+		ins := filter[pc]
+		switch ins.Code {
+		case syscall.BPF_LD | syscall.BPF_W | syscall.BPF_ABS:
+			acc = binary.LittleEndian.Uint32(data[ins.K:])
+		case syscall.BPF_RET | syscall.BPF_K:
+			return ins.K
+		case syscall.BPF_JMP | syscall.BPF_JEQ | syscall.BPF_K, syscall.BPF_JMP | syscall.BPF_JGE | syscall.BPF_K, syscall.BPF_JMP | syscall.BPF_JSET | syscall.BPF_K:
+			var match bool
+			switch ins.Code &^ (syscall.BPF_JMP | syscall.BPF_K) {
+			case syscall.BPF_JEQ:
+				match = acc == ins.K
+			case syscall.BPF_JGE:
+				match = acc >= ins.K
+			default:
+				match = acc&ins.K != 0
+			}
+			if match {
+				pc += int(ins.Jt)
+			} else {
+				pc += int(ins.Jf)
+			}
+		default:
+			t.Fatalf("Unexpected instruction %#x at %d", ins.Code, pc)
+		}
+	}
+	t.Fatalf("Filter fell off the end")
+	return 0
+}
+
+func TestBuildSeccompFilter(t *testing.T) {
+	const arch = 0xc000003e
+	filter := buildSeccompFilter(arch, []uint32{10, 20, 30}, 0x40000000)
+	eperm := seccompRetErrno | uint32(syscall.EPERM)
+
+	cases := []struct {
+		name string
+		arch uint32
+		nr   uint32
+		arg0 uint64
+		want uint32
+	}{
+		{"allowed syscall", arch, 0, 0, seccompRetAllow},
+		{"denied syscall", arch, 20, 0, eperm},
+		{"last denied syscall", arch, 30, 0, eperm},
+		{"x32 syscall", arch, 0x40000001, 0, eperm},
+		{"other ABI", 0x40000003, 0, 0, seccompRetKillProcess},
+		{"clone3", arch, sysClone3, 0, seccompRetErrno | uint32(syscall.ENOSYS)},
+		{"thread clone", arch, syscall.SYS_CLONE, syscall.CLONE_VM | syscall.CLONE_THREAD | syscall.CLONE_SIGHAND, seccompRetAllow},
+		{"fork through clone", arch, syscall.SYS_CLONE, uint64(syscall.SIGCHLD), seccompRetAllow},
+		{"clone into a user namespace", arch, syscall.SYS_CLONE, syscall.CLONE_NEWUSER | uint64(syscall.SIGCHLD), seccompRetKillProcess},
+		{"clone into a mount namespace", arch, syscall.SYS_CLONE, syscall.CLONE_NEWNS, seccompRetKillProcess},
+	}
+	for _, tc := range cases {
+		if got := runSeccompFilter(t, filter, tc.arch, tc.nr, tc.arg0); got != tc.want {
+			t.Errorf("%s: expected %#x, got %#x", tc.name, tc.want, got)
+		}
+	}
+}
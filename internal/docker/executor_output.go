@@ -0,0 +1,107 @@
+package docker
+
+import (
+	"bytes"
+	"fmt"
+	"sync"
+)
+
+// maxLoggedOutputBytes acota cuánto de cada salida se imprime en el log del servicio
+const maxLoggedOutputBytes = 1000
+
+// outputLimiter acota los bytes combinados de stdout y stderr de un comando mientras
+// corre. Al superar el límite deja de acumular y llama a onExceed una sola vez para que
+// el llamador mate el proceso en lugar de seguir drenando su salida.
+type outputLimiter struct {
+	limit    int64 // 0 = sin límite
+	onExceed func()
+
+	mu       sync.Mutex
+	written  int64
+	exceeded bool
+}
+
+// limitedBuffer es el destino de un stream (stdout o stderr) con el límite compartido
+type limitedBuffer struct {
+	limiter   *outputLimiter
+	buf       bytes.Buffer
+	truncated bool // este stream fue el que superó el límite
+}
+
+// newOutputLimiter crea un limitador con el límite y la acción de corte dados
+func newOutputLimiter(limit int64, onExceed func()) *outputLimiter {
+	return &outputLimiter{limit: limit, onExceed: onExceed}
+}
+
+// buffer crea un destino para un stream que comparte el límite de bytes
+func (l *outputLimiter) buffer() *limitedBuffer {
+	return &limitedBuffer{limiter: l}
+}
+
+// Exceeded indica si la salida superó el límite
+func (l *outputLimiter) Exceeded() bool {
+	l.mu.Lock()
+	defer l.mu.Unlock()
+	return l.exceeded
+}
+
+// Write nunca falla: el resto de la salida se descarta para no bloquear al proceso
+// hasta que el llamador lo mate
+func (b *limitedBuffer) Write(p []byte) (int, error) {
+	l := b.limiter
+	l.mu.Lock()
+	if l.exceeded {
+		l.mu.Unlock()
+		return len(p), nil
+	}
+
+	if l.limit > 0 && l.written+int64(len(p)) > l.limit {
+		b.buf.Write(p[:l.limit-l.written])
+		l.written = l.limit
+		l.exceeded = true
+		b.truncated = true
+		l.mu.Unlock()
+		if l.onExceed != nil {
+			l.onExceed()
+		}
+		return len(p), nil
+	}
+
+	b.buf.Write(p)
+	l.written += int64(len(p))
+	l.mu.Unlock()
+	return len(p), nil
+}
+
+// String retorna lo acumulado, con una marca al final si el stream fue truncado
+func (b *limitedBuffer) String() string {
+	b.limiter.mu.Lock()
+	defer b.limiter.mu.Unlock()
+	if b.truncated {
+		return b.buf.String() + fmt.Sprintf("\n... [output truncated: limit of %d bytes exceeded]", b.limiter.limit)
+	}
+	return b.buf.String()
+}
+
+// Bytes retorna lo acumulado, sin marca de truncado
+func (b *limitedBuffer) Bytes() []byte {
+	b.limiter.mu.Lock()
+	defer b.limiter.mu.Unlock()
+	return b.buf.Bytes()
+}
+
+// applyOutputLimitExceeded marca el resultado de una fase cortada por exceso de salida
+func applyOutputLimitExceeded(result *ExecutionResult, output *commandOutput, limit int64, phase string) {
+	result.ErrorType = "output_limit_exceeded"
+	result.ErrorMessage = fmt.Sprintf("%s output exceeded the limit of %d bytes", phase, limit)
+	result.StdOut = output.StdOut
+	result.StdErr = output.StdErr
+}
+
+// outputPreview recorta una salida para el log del servicio
+func outputPreview(output string) string {
+	if len(output) <= maxLoggedOutputBytes {
+		return output
+	}
+	return output[:maxLoggedOutputBytes] + fmt.Sprintf("\n... (truncated, total: %d bytes)", len(output))
+}
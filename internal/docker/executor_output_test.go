@@ -0,0 +1,26 @@
+package docker
+
+import (
+	"strings"
+	"testing"
+)
+
+func TestOutputLimiter_SharesLimitAndStopsOnce(t *testing.T) {
+	calls := 0
+	limiter := newOutputLimiter(10, func() { calls++ })
+	stdout, stderr := limiter.buffer(), limiter.buffer()
+
+	stdout.Write([]byte("123456"))
+	stderr.Write([]byte("abcdef"))
+	stdout.Write([]byte("more output"))
+
+	if !limiter.Exceeded() || calls != 1 {
+		t.Fatalf("Expected the limit to be exceeded once, got exceeded=%v calls=%d", limiter.Exceeded(), calls)
+	}
+	if stdout.String() != "123456" {
+		t.Errorf("Expected stdout to keep its bytes without a marker, got %q", stdout.String())
+	}
+	if !strings.HasPrefix(stderr.String(), "abcd\n") || !strings.Contains(stderr.String(), "output truncated") {
+		t.Errorf("Expected stderr to be cut at the shared limit with a marker, got %q", stderr.String())
+	}
+}
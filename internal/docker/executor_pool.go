@@ -0,0 +1,263 @@
+package docker
+
+import (
+	"context"
+	"fmt"
+	"log"
+	"path"
+	"sync"
+	"time"
+
+	"github.com/docker/docker/api/types/container"
+	"github.com/docker/docker/api/types/filters"
+	"github.com/google/uuid"
+	"go.opentelemetry.io/otel/attribute"
+	"go.opentelemetry.io/otel/trace"
+
+	"code-runner/internal/metrics"
+	"code-runner/internal/tracing"
+)
+
+// sandbox representa un contenedor iniciado que recibe ejecuciones vía docker exec
+type sandbox struct {
+	id     string
+	uses   int
+	pooled bool
+
+	// Límites aplicados actualmente al contenedor (cambian entre fases)
+	memoryLimitMB int64
+	cpuLimit      float64
+}
+
+// containerPool mantiene contenedores coderunner-cpp pre-iniciados y listos
+// para reutilizarse entre ejecuciones
+type containerPool struct {
+	mu     sync.Mutex
+	idle   chan *sandbox
+	closed bool
+}
+
+// StartPool crea y arranca los contenedores del pool según DockerConfig.PoolSize.
+// Con PoolSize <= 0 el pool queda deshabilitado y cada ejecución usa un contenedor propio.
+func (e *DockerExecutor) StartPool(ctx context.Context) error {
+	if err := e.removeStaleContainers(ctx); err != nil {
+		return err
+	}
+
+	if e.dockerConfig.PoolSize <= 0 {
+		log.Printf("ℹ️  Container pool disabled, using one container per execution")
+		return nil
+	}
+
+	log.Printf("🏊 Warming up container pool (%d containers, max %d uses each)...",
+		e.dockerConfig.PoolSize, e.dockerConfig.PoolMaxUses)
+
+	e.pool = &containerPool{
+		idle: make(chan *sandbox, e.dockerConfig.PoolSize),
+	}
+
+	for i := 0; i < e.dockerConfig.PoolSize; i++ {
+		sb, err := e.newPooledSandbox(ctx)
+		if err != nil {
+			return fmt.Errorf("failed to warm up container pool: %w", err)
+		}
+		e.pool.idle <- sb
+		metrics.Containers.WithLabelValues("idle").Inc()
+	}
+
+	log.Printf("✅ Container pool ready")
+	return nil
+}
+
+// removeStaleContainers elimina los contenedores con managedLabel que dejó un proceso
+// anterior que terminó sin cerrar el executor (crash, SIGKILL). Asume que cada host de
+// Docker atiende a una sola instancia de code-runner.
+func (e *DockerExecutor) removeStaleContainers(ctx context.Context) error {
+	containers, err := e.client.ContainerList(ctx, container.ListOptions{
+		All:     true,
+		Filters: filters.NewArgs(filters.Arg("label", managedLabel+"=true")),
+	})
+	if err != nil {
+		return fmt.Errorf("failed to list stale containers: %w", err)
+	}
+
+	for _, c := range containers {
+		log.Printf("🧹 Removing stale container %s", c.ID[:12])
+		if err := e.client.ContainerRemove(ctx, c.ID, container.RemoveOptions{Force: true}); err != nil {
+			return fmt.Errorf("failed to remove stale container: %w", err)
+		}
+	}
+	return nil
+}
+
+// acquireSandbox obtiene un contenedor listo para ejecutar. Usa uno del pool si hay
+// disponible y la imagen coincide con la del pool; si no, crea uno dedicado.
+func (e *DockerExecutor) acquireSandbox(ctx context.Context, config *ExecutionConfig) (_ *sandbox, err error) {
+	defer metrics.ObserveStage(metrics.StageContainerAcquire, time.Now())
+	ctx, span := tracing.Start(ctx, "acquireSandbox")
+	defer func() { tracing.End(span, err) }()
+
+	if e.pool != nil && e.matchesPoolConfig(config) {
+		select {
+		case sb := <-e.pool.idle:
+			metrics.Containers.WithLabelValues("idle").Dec()
+			metrics.Containers.WithLabelValues("in_use").Inc()
+			span.SetAttributes(attribute.Bool("coderunner.pooled", true))
+			sb.uses++
+			log.Printf("  ♻️  Using pooled container %s (use %d/%d)", sb.id[:12], sb.uses, e.dockerConfig.PoolMaxUses)
+			return sb, nil
+		default:
+			log.Printf("  ⚠️  Container pool exhausted, creating dedicated container")
+		}
+	}
+
+	containerName := fmt.Sprintf("coderunner-%s", config.ExecutionID.String())
+	containerID, err := e.createContainer(ctx, config.ImageName, config.WorkDir, config.MemoryLimitMB, config.CPULimit, containerName)
+	if err != nil {
+		return nil, err
+	}
+
+	metrics.Containers.WithLabelValues("in_use").Inc()
+	return &sandbox{id: containerID, uses: 1, memoryLimitMB: config.MemoryLimitMB, cpuLimit: config.CPULimit}, nil
+}
+
+// releaseSandbox limpia el workspace de la ejecución y devuelve el contenedor al pool.
+// Los contenedores dedicados, contaminados o que alcanzaron PoolMaxUses se eliminan
+// y, si pertenecían al pool, se reemplazan en segundo plano. ctx solo aporta la traza:
+// la limpieza se hace aunque la ejecución haya sido cancelada.
+func (e *DockerExecutor) releaseSandbox(ctx context.Context, sb *sandbox, workDir string, contaminated bool) {
+	ctx, cancel := context.WithTimeout(context.WithoutCancel(ctx), 10*time.Second)
+	defer cancel()
+	ctx, span := tracing.Start(ctx, "releaseSandbox", trace.WithAttributes(attribute.Bool("coderunner.contaminated", contaminated)))
+	defer span.End()
+	metrics.Containers.WithLabelValues("in_use").Dec()
+
+	if !sb.pooled {
+		if err := e.Cleanup(ctx, sb.id); err != nil {
+			log.Printf("  ⚠️  Warning: failed to cleanup container: %v", err)
+		}
+		return
+	}
+
+	recycle := contaminated
+	if !recycle && e.dockerConfig.PoolMaxUses > 0 && sb.uses >= e.dockerConfig.PoolMaxUses {
+		log.Printf("  🔁 Pooled container %s reached %d uses, recycling", sb.id[:12], sb.uses)
+		recycle = true
+	}
+	if !recycle {
+		recycle = !e.resetSandbox(ctx, sb, workDir)
+	}
+
+	if !recycle && e.returnToPool(sb) {
+		log.Printf("  ♻️  Container %s returned to pool", sb.id[:12])
+		return
+	}
+
+	e.removeContainer(sb.id)
+	if !e.poolClosed() {
+		go e.replenishPool()
+	}
+}
+
+// resetSandbox vacía los tmpfs del contenedor (todo el workspace, no solo el directorio
+// de la ejecución: la solución puede escribir fuera de él), los temporales y las
+// estadísticas, y verifica que no queden procesos del estudiante vivos; retorna false si
+// el contenedor no puede reutilizarse
+func (e *DockerExecutor) resetSandbox(ctx context.Context, sb *sandbox, workDir string) bool {
+	command := []string{"find", path.Dir(workDir), "/tmp", path.Dir(statsFilePath), "-mindepth", "1", "-delete"}
+	output, err := e.execInContainer(ctx, sb.id, "/", "root", command, 5*time.Second, nil)
+	if err != nil || output.TimedOut || output.ExitCode != 0 {
+		log.Printf("  ⚠️  Failed to clean workspace in container %s, discarding it", sb.id[:12])
+		return false
+	}
+
+	// Only the container's main process (sleep infinity) must remain
+	top, err := e.client.ContainerTop(ctx, sb.id, nil)
+	if err != nil || len(top.Processes) != 1 {
+		log.Printf("  ⚠️  Leftover processes in container %s, discarding it", sb.id[:12])
+		return false
+	}
+
+	return true
+}
+
+// replenishPool crea un contenedor nuevo para reemplazar uno descartado
+func (e *DockerExecutor) replenishPool() {
+	ctx, cancel := context.WithTimeout(context.Background(), 30*time.Second)
+	defer cancel()
+
+	sb, err := e.newPooledSandbox(ctx)
+	if err != nil {
+		log.Printf("  ⚠️  Warning: failed to replenish container pool: %v", err)
+		return
+	}
+
+	if !e.returnToPool(sb) {
+		e.removeContainer(sb.id)
+	}
+}
+
+// returnToPool deja el contenedor disponible para la siguiente ejecución;
+// retorna false si el pool ya fue cerrado
+func (e *DockerExecutor) returnToPool(sb *sandbox) bool {
+	e.pool.mu.Lock()
+	defer e.pool.mu.Unlock()
+
+	if e.pool.closed {
+		return false
+	}
+	e.pool.idle <- sb
+	metrics.Containers.WithLabelValues("idle").Inc()
+	return true
+}
+
+// newPooledSandbox crea un contenedor del pool con los límites por defecto
+func (e *DockerExecutor) newPooledSandbox(ctx context.Context) (*sandbox, error) {
+	containerName := fmt.Sprintf("coderunner-pool-%s", uuid.New().String())
+	containerID, err := e.createContainer(ctx, e.dockerConfig.CppImageName, "/workspace",
+		e.dockerConfig.DefaultMemoryMB, e.dockerConfig.DefaultCPULimit, containerName)
+	if err != nil {
+		return nil, err
+	}
+	return &sandbox{
+		id:            containerID,
+		pooled:        true,
+		memoryLimitMB: e.dockerConfig.DefaultMemoryMB,
+		cpuLimit:      e.dockerConfig.DefaultCPULimit,
+	}, nil
+}
+
+// matchesPoolConfig indica si la ejecución puede correr en un contenedor del pool.
+// Los límites de recursos se ajustan en cada fase, así que solo importa la imagen.
+func (e *DockerExecutor) matchesPoolConfig(config *ExecutionConfig) bool {
+	return config.ImageName == e.dockerConfig.CppImageName
+}
+
+// poolClosed indica si el pool fue cerrado con drainPool
+func (e *DockerExecutor) poolClosed() bool {
+	e.pool.mu.Lock()
+	defer e.pool.mu.Unlock()
+	return e.pool.closed
+}
+
+// drainPool elimina todos los contenedores inactivos del pool
+func (e *DockerExecutor) drainPool() {
+	if e.pool == nil {
+		return
+	}
+
+	e.pool.mu.Lock()
+	e.pool.closed = true
+	e.pool.mu.Unlock()
+
+	for {
+		select {
+		case sb := <-e.pool.idle:
+			metrics.Containers.WithLabelValues("idle").Dec()
+			e.removeContainer(sb.id)
+		default:
+			log.Printf("✅ Container pool drained")
+			return
+		}
+	}
+}
@@ -0,0 +1,83 @@
+package docker
+
+import (
+	"bytes"
+	"io"
+)
+
+// maxProgressLineBytes acota una línea del stdout retenida a la espera de su salto de línea;
+// las líneas más largas no pueden ser del listener y se descartan
+const maxProgressLineBytes = 4 * 1024
+
+// emitProgress envía un evento de avance si la ejecución tiene un receptor
+func (c *ExecutionConfig) emitProgress(event ProgressEvent) {
+	if c.Progress != nil {
+		c.Progress(event)
+	}
+}
+
+// progressWriter recibe el stdout de la solución a medida que se produce y emite un
+// evento de test por cada línea test-timing del listener del harness
+type progressWriter struct {
+	config   *ExecutionConfig
+	testIDs  map[string]string // ID normalizado -> ID original
+	line     []byte
+	skipping bool // descartando el resto de una línea demasiado larga
+}
+
+// newProgressWriter retorna un writer para el stdout de la fase de ejecución, o nil si
+// nadie espera eventos de avance
+func newProgressWriter(config *ExecutionConfig) io.Writer {
+	if config.Progress == nil {
+		return nil
+	}
+	testIDs := make(map[string]string, len(config.TestIDs))
+	for _, testID := range config.TestIDs {
+		testIDs[normalizeTestIdentifier(testID)] = testID
+	}
+	return &progressWriter{config: config, testIDs: testIDs}
+}
+
+// Write nunca falla: un error cortaría la copia del stdout que sí se necesita
+func (w *progressWriter) Write(p []byte) (int, error) {
+	data := p
+	for len(data) > 0 {
+		newline := bytes.IndexByte(data, '\n')
+		if newline < 0 {
+			if !w.skipping && len(w.line)+len(data) <= maxProgressLineBytes {
+				w.line = append(w.line, data...)
+			} else {
+				w.line = w.line[:0]
+				w.skipping = true
+			}
+			break
+		}
+
+		if !w.skipping && len(w.line)+newline <= maxProgressLineBytes {
+			w.line = append(w.line, data[:newline]...)
+			w.handleLine(string(bytes.TrimSpace(w.line)))
+		}
+		w.line = w.line[:0]
+		w.skipping = false
+		data = data[newline+1:]
+	}
+	return len(p), nil
+}
+
+// handleLine emite el evento de una línea test-timing de un test conocido
+func (w *progressWriter) handleLine(line string) {
+	name, timing, ok := parseTestTiming(line)
+	if !ok {
+		return
+	}
+	testID, known := w.testIDs[normalizeTestIdentifier(name)]
+	if !known {
+		return
+	}
+	w.config.emitProgress(ProgressEvent{
+		Phase:      PhaseTest,
+		TestID:     testID,
+		Passed:     timing.passed,
+		DurationNS: timing.durationNS,
+	})
+}
@@ -0,0 +1,39 @@
+package docker
+
+import (
+	"strings"
+	"testing"
+)
+
+func TestProgressWriter_EmitsTestEventsFromSplitWrites(t *testing.T) {
+	var events []ProgressEvent
+	config := &ExecutionConfig{
+		TestIDs:  []string{"Test-A", "test-b"},
+		Progress: func(event ProgressEvent) { events = append(events, event) },
+	}
+	w := newProgressWriter(config)
+
+	chunks := []string{
+		"student output\n[coderunner] test-timing passed=1 duration_ns=2500000 allo",
+		"cations=3 name=test-a\n" + strings.Repeat("x", maxProgressLineBytes+10),
+		"[coderunner] test-timing passed=1 duration_ns=1 allocations=0 name=test-b\n",
+		"[coderunner] test-timing passed=0 duration_ns=7 allocations=0 name=unknown\n",
+		"[coderunner] test-timing passed=0 duration_ns=9 allocations=1 name=test-b\n",
+	}
+	for _, chunk := range chunks {
+		if n, err := w.Write([]byte(chunk)); err != nil || n != len(chunk) {
+			t.Fatalf("Write returned (%d, %v), expected (%d, nil)", n, err, len(chunk))
+		}
+	}
+
+	// The line glued to the oversized one is dropped, as is the unknown test
+	if len(events) != 2 {
+		t.Fatalf("Expected 2 test events, got %d: %+v", len(events), events)
+	}
+	if events[0].TestID != "Test-A" || !events[0].Passed || events[0].DurationNS != 2500000 {
+		t.Errorf("Unexpected first event: %+v", events[0])
+	}
+	if events[1].TestID != "test-b" || events[1].Passed || events[1].Phase != PhaseTest {
+		t.Errorf("Unexpected second event: %+v", events[1])
+	}
+}
@@ -0,0 +1,204 @@
+package docker
+
+import (
+	"bytes"
+	"context"
+	"encoding/json"
+	"fmt"
+	"log"
+	"path"
+	"strings"
+	"sync"
+	"time"
+
+	"code-runner/internal/metrics"
+	"code-runner/internal/tracing"
+)
+
+// testShard es un rango contiguo de TEST_CASEs (en orden de declaración, 1-based e
+// inclusivo) que corre en su propio proceso, con sus propios archivos de stats y reporte
+type testShard struct {
+	first, last int
+	ranged      bool // false: un solo shard con todos los tests, sin filtro de rango
+	statsPath   string
+	reportPath  string
+}
+
+// args retorna los filtros de doctest que limitan el proceso a su rango de tests
+func (s testShard) args() []string {
+	if !s.ranged {
+		return nil
+	}
+	return []string{"--order-by=file", fmt.Sprintf("--first=%d", s.first), fmt.Sprintf("--last=%d", s.last)}
+}
+
+// testShardCount decide en cuántos procesos se reparten los tests: como máximo
+// MaxTestShards, uno por core completo de la cuota de CPU y uno por test
+func (e *DockerExecutor) testShardCount(config *ExecutionConfig) int {
+	shards := e.dockerConfig.MaxTestShards
+	if cores := int(config.CPULimit); cores < shards {
+		shards = cores
+	}
+	if len(config.TestIDs) < shards {
+		shards = len(config.TestIDs)
+	}
+	if shards < 1 {
+		shards = 1
+	}
+	return shards
+}
+
+// planTestShards reparte testCount tests en count rangos contiguos de tamaño parejo
+func planTestShards(testCount, count int) []testShard {
+	if count <= 1 {
+		return []testShard{{first: 1, last: testCount, statsPath: statsFilePath, reportPath: testReportFilePath}}
+	}
+
+	statsDir := path.Dir(statsFilePath)
+	shards := make([]testShard, count)
+	for i := range shards {
+		shards[i] = testShard{
+			first:      i*testCount/count + 1,
+			last:       (i + 1) * testCount / count,
+			ranged:     true,
+			statsPath:  path.Join(statsDir, fmt.Sprintf("solution-%d.stats", i)),
+			reportPath: path.Join(statsDir, fmt.Sprintf("report-%d.jsonl", i)),
+		}
+	}
+	return shards
+}
+
+// runTestShards ejecuta la solución una vez por shard, todos a la vez dentro de la cuota
+// de CPU del contenedor, y combina sus salidas. MaxOutputBytes limita la salida de toda
+// la corrida, no la de cada shard: al superarlo se detienen todos los shards.
+func (e *DockerExecutor) runTestShards(ctx context.Context, containerID, workDir string, config *ExecutionConfig, shards []testShard) (*commandOutput, error) {
+	timeout := time.Duration(config.TimeoutSeconds) * time.Second
+	if len(shards) > 1 {
+		log.Printf("  🧩 Running %d tests in %d parallel shards", len(config.TestIDs), len(shards))
+	}
+
+	shardCtx, cancelShards := context.WithCancel(ctx)
+	defer cancelShards()
+	limiter := newOutputLimiter(e.dockerConfig.MaxOutputBytes, cancelShards)
+
+	outputs := make([]*commandOutput, len(shards))
+	errs := make([]error, len(shards))
+	var wg sync.WaitGroup
+	for i, shard := range shards {
+		wg.Add(1)
+		go func(i int, shard testShard) {
+			defer wg.Done()
+			// measure runs as root to drop to the coderunner user and record the solution's rusage
+			command := append([]string{measureBinary, shard.statsPath, shard.reportPath, "./solution"}, e.harnessArgs(config)...)
+			command = append(command, shard.args()...)
+			outputs[i], errs[i] = e.execWithOutputLimiter(shardCtx, containerID, workDir, "root", command, timeout, newProgressWriter(config), limiter)
+		}(i, shard)
+	}
+	wg.Wait()
+
+	for _, err := range errs {
+		if err != nil {
+			return nil, err
+		}
+	}
+	return mergeShardOutputs(outputs), nil
+}
+
+// mergeShardOutputs combina las salidas de los shards: la salida concatenada en orden de
+// shard y el primer exit code distinto de cero (un SIGKILL tiene prioridad)
+func mergeShardOutputs(outputs []*commandOutput) *commandOutput {
+	if len(outputs) == 1 {
+		return outputs[0]
+	}
+
+	merged := &commandOutput{}
+	var stdout, stderr strings.Builder
+	for _, output := range outputs {
+		stdout.WriteString(output.StdOut)
+		stderr.WriteString(output.StdErr)
+		merged.TimedOut = merged.TimedOut || output.TimedOut
+		merged.OutputLimitExceeded = merged.OutputLimitExceeded || output.OutputLimitExceeded
+		if output.ExitCode != 0 && (merged.ExitCode == 0 || output.ExitCode == 137) {
+			merged.ExitCode = output.ExitCode
+		}
+	}
+	merged.StdOut = stdout.String()
+	merged.StdErr = stderr.String()
+	return merged
+}
+
+// collectShardResults lee las estadísticas y el reporte de cada shard. Los shards corren a
+// la vez, así que la memoria y la CPU se suman y el tiempo real es el del más lento.
+func (e *DockerExecutor) collectShardResults(ctx context.Context, containerID string, shards []testShard, result *ExecutionResult, output *commandOutput) {
+	defer metrics.ObserveStage(metrics.StageLogCapture, time.Now())
+	ctx, span := tracing.Start(ctx, "collectResults")
+	defer span.End()
+
+	total := &processStats{}
+	measured := 0
+	reports := make([][]byte, 0, len(shards))
+	for _, shard := range shards {
+		if stats, err := e.readProcessStats(ctx, containerID, shard.statsPath); err != nil {
+			log.Printf("  ⚠️  Process stats not available: %v", err)
+		} else {
+			total.PeakRSSKB += stats.PeakRSSKB
+			total.UserMS += stats.UserMS
+			total.SysMS += stats.SysMS
+			if stats.WallMS > total.WallMS {
+				total.WallMS = stats.WallMS
+			}
+			measured++
+		}
+		reports = append(reports, e.collectTestReport(ctx, containerID, shard.reportPath))
+	}
+
+	if measured > 0 {
+		total.apply(result)
+	}
+	if len(shards) == 1 {
+		output.Report = reports[0]
+		return
+	}
+	output.Report = mergeShardReports(reports)
+}
+
+// mergeShardReports une los reportes JSON Lines de los shards en uno solo, como si una
+// única corrida hubiera ejecutado todos los tests: los eventos de cada test se conservan y
+// los run_end se reemplazan por uno combinado. Una línea incompleta al final de un reporte
+// (shard que crasheó) se descarta; si algún shard no llegó a run_end, tampoco lo hace el
+// reporte combinado.
+func mergeShardReports(reports [][]byte) []byte {
+	var merged bytes.Buffer
+	runEnd := testReportEvent{Event: "run_end"}
+	ended := 0
+
+	for _, report := range reports {
+		for len(report) > 0 {
+			line, rest, complete := bytes.Cut(report, []byte("\n"))
+			report = rest
+			if !complete {
+				break
+			}
+
+			var event testReportEvent
+			if bytes.HasPrefix(line, []byte(`{"event":"run_end"`)) && json.Unmarshal(line, &event) == nil {
+				// Every shard counts all the tests passing the filters, not only its range
+				runEnd.Total = event.Total
+				runEnd.Failed += event.Failed
+				runEnd.Aborted = runEnd.Aborted || event.Aborted
+				ended++
+				continue
+			}
+			merged.Write(line)
+			merged.WriteByte('\n')
+		}
+	}
+
+	if ended > 0 && ended == len(reports) {
+		if line, err := json.Marshal(runEnd); err == nil {
+			merged.Write(line)
+			merged.WriteByte('\n')
+		}
+	}
+	return merged.Bytes()
+}
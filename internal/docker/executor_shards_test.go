@@ -0,0 +1,66 @@
+package docker
+
+import (
+	"bytes"
+	"errors"
+	"testing"
+)
+
+func TestPlanTestShards_CoversEveryTestOnce(t *testing.T) {
+	shards := planTestShards(10, 3)
+	if len(shards) != 3 {
+		t.Fatalf("Expected 3 shards, got %d", len(shards))
+	}
+
+	next := 1
+	for _, shard := range shards {
+		if shard.first != next || shard.last < shard.first {
+			t.Fatalf("Expected shard to start at %d, got [%d, %d]", next, shard.first, shard.last)
+		}
+		next = shard.last + 1
+	}
+	if next != 11 {
+		t.Errorf("Expected shards to cover tests 1-10, covered up to %d", next-1)
+	}
+
+	single := planTestShards(10, 1)
+	if len(single) != 1 || single[0].args() != nil || single[0].reportPath != testReportFilePath {
+		t.Errorf("Expected a single unfiltered shard, got %+v", single)
+	}
+}
+
+func TestMergeShardReports(t *testing.T) {
+	parser := &DoctestParser{}
+	testIDs := []string{"a", "b", "c"}
+
+	shardA := `{"event":"case_start","name":"a"}
+{"event":"case_end","name":"a","passed":true,"duration_ns":5,"allocations":0}
+{"event":"run_end","total":3,"failed":0,"aborted":false}
+`
+	shardB := `{"event":"case_start","name":"b"}
+{"event":"assert","name":"b","message":"CHECK( f() == 2 ) is NOT correct!"}
+{"event":"case_end","name":"b","passed":false,"duration_ns":7,"allocations":1}
+{"event":"case_start","name":"c"}
+{"event":"case_end","name":"c","passed":true,"duration_ns":9,"allocations":0}
+{"event":"run_end","total":3,"failed":1,"aborted":false}
+`
+	results, err := parser.ParseReport(bytes.NewReader(mergeShardReports([][]byte{[]byte(shardA), []byte(shardB)})), testIDs, 1)
+	if err != nil {
+		t.Fatalf("Expected no error, got: %v", err)
+	}
+	if !results[0].Passed || results[1].Passed || !results[2].Passed {
+		t.Errorf("Unexpected merged results: %+v", results)
+	}
+
+	// A shard killed mid-line: its partial event is dropped, its tests did not finish and
+	// the merged report has no run_end
+	crashed := `{"event":"case_start","name":"b"}
+{"event":"case_end","na`
+	results, err = parser.ParseReport(bytes.NewReader(mergeShardReports([][]byte{[]byte(shardA), []byte(crashed)})), testIDs, 137)
+	if !errors.Is(err, ErrIncompleteReport) {
+		t.Fatalf("Expected ErrIncompleteReport, got: %v", err)
+	}
+	if !results[0].Passed || results[1].Passed || results[1].ErrorMessage != "Test did not finish" || results[2].Passed {
+		t.Errorf("Unexpected results for a crashed shard: %+v", results)
+	}
+}
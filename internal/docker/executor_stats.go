@@ -0,0 +1,77 @@
+package docker
+
+import (
+	"bufio"
+	"fmt"
+	"strconv"
+	"strings"
+)
+
+const (
+	// measureBinary envuelve la solución en la imagen (ver docker/cpp/measure.c):
+	// la ejecuta como el usuario coderunner y registra su consumo en statsFilePath
+	measureBinary = "/opt/coderunner/bin/measure"
+
+	// statsFilePath y testReportFilePath están en un directorio de root, fuera del alcance
+	// de la solución; el reporte le llega abierto en el fd 3 (CODERUNNER_REPORT_FD)
+	statsFilePath      = "/var/lib/coderunner/stats/solution.stats"
+	testReportFilePath = "/var/lib/coderunner/stats/report.jsonl"
+
+	// maxProcessStatsBytes y maxTestReportBytes acotan lo que se lee de vuelta al servicio
+	maxProcessStatsBytes = 4 * 1024
+	maxTestReportBytes   = 4 * 1024 * 1024
+)
+
+// processStats es el consumo de recursos del proceso de la solución (rusage de wait4)
+type processStats struct {
+	PeakRSSKB int64
+	UserMS    int64
+	SysMS     int64
+	WallMS    int64
+}
+
+// parseProcessStats interpreta el formato clave=valor que escriben measure y el sandbox
+// nativo. Las claves desconocidas se ignoran.
+func parseProcessStats(data []byte) (*processStats, error) {
+	stats := &processStats{}
+	fields := map[string]*int64{
+		"peak_rss_kb": &stats.PeakRSSKB,
+		"user_ms":     &stats.UserMS,
+		"sys_ms":      &stats.SysMS,
+		"wall_ms":     &stats.WallMS,
+	}
+
+	found := 0
+	scanner := bufio.NewScanner(strings.NewReader(string(data)))
+	for scanner.Scan() {
+		key, value, ok := strings.Cut(strings.TrimSpace(scanner.Text()), "=")
+		field, known := fields[key]
+		if !ok || !known {
+			continue
+		}
+		parsed, err := strconv.ParseInt(value, 10, 64)
+		if err != nil {
+			return nil, fmt.Errorf("failed to parse %s: %w", key, err)
+		}
+		*field = parsed
+		found++
+	}
+	if found == 0 {
+		return nil, fmt.Errorf("no process stats found")
+	}
+	return stats, nil
+}
+
+// formatProcessStats serializa las estadísticas en el mismo formato que measure
+func formatProcessStats(stats *processStats) string {
+	return fmt.Sprintf("peak_rss_kb=%d\nuser_ms=%d\nsys_ms=%d\nwall_ms=%d\n",
+		stats.PeakRSSKB, stats.UserMS, stats.SysMS, stats.WallMS)
+}
+
+// apply copia el consumo medido al resultado de la ejecución
+func (s *processStats) apply(result *ExecutionResult) {
+	result.MemoryUsageMB = float64(s.PeakRSSKB) / 1024
+	result.CPUUserMS = s.UserMS
+	result.CPUSystemMS = s.SysMS
+	result.WallTimeMS = s.WallMS
+}
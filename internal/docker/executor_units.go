@@ -0,0 +1,75 @@
+package docker
+
+import (
+	"context"
+	"log"
+	"path"
+)
+
+// Archivos de la compilación separada dentro del workspace
+const (
+	declarationsFileName = "solution.h"
+	testUnitFileName     = "tests.cpp"
+	testObjectFileName   = "tests.o"
+)
+
+// compilePlan describe cómo se compila una solución que no estaba en el cache: los archivos
+// que se copian al workspace, el comando de la fase de compilación y, si el objeto de los
+// tests se compila en esta ejecución, la clave con la que se guarda en el cache
+type compilePlan struct {
+	files     []workspaceFile
+	command   string
+	objectKey string
+}
+
+// planCompilation arma la compilación de config con extraFlags. Sin compilación separada se
+// compila SourceCode completo; con ella, solution.cpp se compila y enlaza contra tests.o,
+// que sale del cache si ya se compiló la misma unidad de tests con el mismo perfil e imagen.
+func (e *DockerExecutor) planCompilation(config *ExecutionConfig, extraFlags, imageID string) compilePlan {
+	if config.TestUnit == "" {
+		return compilePlan{
+			files:   []workspaceFile{{Name: "solution.cpp", Data: []byte(config.SourceCode), Mode: 0644}},
+			command: config.Compiler.CompileCommand(extraFlags),
+		}
+	}
+
+	plan := compilePlan{
+		files:   []workspaceFile{{Name: "solution.cpp", Data: []byte(config.SolutionUnit), Mode: 0644}},
+		command: config.Compiler.SplitCompileCommand(extraFlags),
+	}
+
+	objectCommand := config.Compiler.TestObjectCommand(extraFlags)
+	var objectKey string
+	if e.compileCache != nil {
+		objectKey = CompileCacheKey(config.Declarations+"\x00"+config.TestUnit, objectCommand, imageID)
+		if object, ok := e.compileCache.Get(objectKey); ok {
+			log.Printf("  🗃️  Test object cache HIT: compiling only the solution")
+			plan.files = append(plan.files, workspaceFile{Name: testObjectFileName, Data: object, Mode: 0644})
+			return plan
+		}
+	}
+
+	plan.files = append(plan.files,
+		workspaceFile{Name: declarationsFileName, Data: []byte(config.Declarations), Mode: 0644},
+		workspaceFile{Name: testUnitFileName, Data: []byte(config.TestUnit), Mode: 0644},
+	)
+	plan.command = objectCommand + " && " + plan.command
+	plan.objectKey = objectKey
+	return plan
+}
+
+// storeTestObject guarda en el cache el objeto de los tests compilado en esta ejecución
+func (e *DockerExecutor) storeTestObject(ctx context.Context, containerID, workDir string, plan compilePlan) {
+	if plan.objectKey == "" {
+		return
+	}
+
+	object, err := e.readFileFromContainer(ctx, containerID, path.Join(workDir, testObjectFileName), 0)
+	if err != nil {
+		log.Printf("  ⚠️  Warning: failed to read test object: %v", err)
+		return
+	}
+	if err := e.compileCache.Put(plan.objectKey, object); err != nil {
+		log.Printf("  ⚠️  Warning: failed to store test object in compile cache: %v", err)
+	}
+}
@@ -2,9 +2,11 @@ package docker
 
 import (
 	"fmt"
+	"io"
 	"regexp"
 	"strconv"
 	"strings"
+	"time"
 )
 
 // TestResultParser define la interfaz Strategy para parsear resultados de tests
@@ -18,6 +20,16 @@ type TestResultParser interface {
 	DetectsOutput(output string) bool
 }
 
+// ReportParser es implementado por las estrategias que además saben decodificar el
+// reporte estructurado que escribe el harness (ver commandOutput.Report)
+type ReportParser interface {
+	// ParseReport decodifica el reporte en una sola pasada y retorna resultados por test.
+	// exitCode es el del proceso que corrió la solución según measure (o el init nativo).
+	// Solo permite descartar reportes inconsistentes: la solución puede escribir un reporte
+	// completo y salir con 0, así que el reporte no es a prueba de falsificación.
+	ParseReport(report io.Reader, testIDs []string, exitCode int) ([]TestResult, error)
+}
+
 // DoctestParser implementa TestResultParser para doctest (C++)
 type DoctestParser struct{}
 
@@ -48,6 +60,7 @@ func (p *DoctestParser) Parse(output string, testIDs []string) ([]TestResult, er
 	testCasePattern := regexp.MustCompile(`(?i)(?:\[doctest\]\s+)?TEST CASE:\s+(.+)`)
 	summaryPattern := regexp.MustCompile(`\[doctest\]\s+test cases:\s+(\d+)\s*\|\s*(\d+)\s+passed\s*\|\s*(\d+)\s+failed`)
 	failurePattern := regexp.MustCompile(`(?i)(?:ERROR:\s+)?CHECK\(.+\)\s+is NOT correct!`)
+	timings := make(map[string]testTiming)
 
 	var totalTests, passedTests, failedTestsCount int
 	var currentTest string
@@ -64,6 +77,12 @@ func (p *DoctestParser) Parse(output string, testIDs []string) ([]TestResult, er
 			continue
 		}
 
+		// Timing lines come from the harness listener, never from a failure message
+		if name, timing, ok := parseTestTiming(line); ok {
+			timings[normalizeTestIdentifier(name)] = timing
+			continue
+		}
+
 		if matches := testCasePattern.FindStringSubmatch(line); len(matches) > 1 {
 			testName := strings.TrimSpace(matches[1])
 			testName = strings.Trim(testName, `"`)
@@ -118,6 +137,11 @@ func (p *DoctestParser) Parse(output string, testIDs []string) ([]TestResult, er
 			TestName: testID,
 			Passed:   passed,
 		}
+		if timing, ok := timings[normID]; ok {
+			result.DurationNS = timing.durationNS
+			result.ExecutionTimeMS = timing.durationNS / int64(time.Millisecond)
+			result.Allocations = timing.allocations
+		}
 
 		if !passed {
 			if messages := failureMessages[normID]; len(messages) > 0 {
@@ -160,6 +184,36 @@ func (p *DoctestParser) Parse(output string, testIDs []string) ([]TestResult, er
 	return testResults, nil
 }
 
+// testTiming es la medición de un TEST_CASE reportada por el listener del harness
+// (ver docker/cpp/doctest_main.cpp)
+type testTiming struct {
+	passed      bool
+	durationNS  int64
+	allocations int64
+}
+
+// testTimingPattern reconoce las líneas del listener (passed= falta en imágenes anteriores):
+// [coderunner] test-timing passed=<0|1> duration_ns=<ns> allocations=<n> name=<test>
+var testTimingPattern = regexp.MustCompile(`^\[coderunner\] test-timing (?:passed=([01]) )?duration_ns=(\d+) allocations=(-?\d+) name=(.+)$`)
+
+// parseTestTiming interpreta una línea de timing del harness
+func parseTestTiming(line string) (string, testTiming, bool) {
+	matches := testTimingPattern.FindStringSubmatch(line)
+	if len(matches) != 5 {
+		return "", testTiming{}, false
+	}
+	durationNS, err := strconv.ParseInt(matches[2], 10, 64)
+	if err != nil {
+		return "", testTiming{}, false
+	}
+	allocations, err := strconv.ParseInt(matches[3], 10, 64)
+	if err != nil {
+		return "", testTiming{}, false
+	}
+	timing := testTiming{passed: matches[1] == "1", durationNS: durationNS, allocations: allocations}
+	return strings.Trim(strings.TrimSpace(matches[4]), `"`), timing, true
+}
+
 func normalizeTestIdentifier(id string) string {
 	return strings.ToLower(strings.TrimSpace(id))
 }
@@ -0,0 +1,94 @@
+package docker
+
+import (
+	"fmt"
+	"io"
+	"log"
+	"strings"
+	"testing"
+)
+
+// benchmarkDoctestOutput builds the stdout of a run with count tests where every
+// tenth test fails, plus printBytes of the solution's own output before the summary
+func benchmarkDoctestOutput(count, printBytes int) (string, []string) {
+	var b strings.Builder
+	testIDs := make([]string, count)
+	failed := 0
+	b.WriteString("[doctest] doctest version is \"2.4.11\"\n[doctest] run with \"--help\" for options\n")
+	for i := range testIDs {
+		testIDs[i] = fmt.Sprintf("6f1c2a4e-0000-4000-8000-%012d", i)
+		passed := 1
+		if i%10 == 0 {
+			passed = 0
+		}
+		fmt.Fprintf(&b, "[coderunner] test-timing passed=%d duration_ns=%d allocations=%d name=%s\n",
+			passed, 1000+i, i%3, testIDs[i])
+		if passed == 0 {
+			failed++
+			b.WriteString("===============================================================================\n")
+			fmt.Fprintf(&b, "[doctest] TEST CASE: %s\n", testIDs[i])
+			fmt.Fprintf(&b, "/workspace/solution.cpp:%d: ERROR: CHECK( solve(arr%d, 1000) == %d ) is NOT correct!\n", 100+i, i, i)
+			fmt.Fprintf(&b, "  values: CHECK( %d == %d )\n\n", i+1, i)
+		}
+	}
+	line := "debug: partial sum = 1234567890\n"
+	for written := 0; written < printBytes; written += len(line) {
+		b.WriteString(line)
+	}
+	b.WriteString("===============================================================================\n")
+	fmt.Fprintf(&b, "[doctest] test cases: %d | %d passed | %d failed\n", count, count-failed, failed)
+	fmt.Fprintf(&b, "[doctest] assertions: %d | %d passed | %d failed\n", count, count-failed, failed)
+	b.WriteString("[doctest] Status: FAILURE\n")
+	return b.String(), testIDs
+}
+
+func BenchmarkDoctestParser_Parse(b *testing.B) {
+	parser := NewDoctestParser()
+	for _, size := range []struct {
+		tests      int
+		printBytes int
+	}{
+		{10, 0},
+		{500, 0},
+		{500, 4 << 20},
+	} {
+		output, testIDs := benchmarkDoctestOutput(size.tests, size.printBytes)
+		b.Run(fmt.Sprintf("tests=%d/stdout=%dKiB", size.tests, len(output)>>10), func(b *testing.B) {
+			b.ReportAllocs()
+			b.SetBytes(int64(len(output)))
+			for i := 0; i < b.N; i++ {
+				if _, err := parser.Parse(output, testIDs); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
+
+func BenchmarkDetectErrorType(b *testing.B) {
+	// detectErrorType logs every classification
+	previous := log.Writer()
+	log.SetOutput(io.Discard)
+	b.Cleanup(func() { log.SetOutput(previous) })
+
+	executor := &DockerExecutor{}
+	noise := strings.Repeat("warning: value computed is not used\n", (4<<20)/36)
+	for _, tc := range []struct {
+		name     string
+		exitCode int
+		stderr   string
+	}{
+		{"segfault", 139, "Segmentation fault (core dumped)\n"},
+		{"test_failure/stderr=4MiB", 1, noise},
+		{"abort/stderr=4MiB", 1, noise + "terminate called after throwing an instance of 'std::bad_alloc'\nAborted\n"},
+	} {
+		b.Run(tc.name, func(b *testing.B) {
+			b.ReportAllocs()
+			b.SetBytes(int64(len(tc.stderr)))
+			for i := 0; i < b.N; i++ {
+				result := &ExecutionResult{ExitCode: tc.exitCode, StdErr: tc.stderr, TotalTests: 500, FailedTests: 50}
+				executor.detectErrorType(result)
+			}
+		})
+	}
+}
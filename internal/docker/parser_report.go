@@ -0,0 +1,194 @@
+package docker
+
+import (
+	"encoding/json"
+	"errors"
+	"fmt"
+	"io"
+	"strings"
+	"syscall"
+	"time"
+)
+
+// Errores de un reporte en el que no se puede confiar: la solución corre en el mismo
+// proceso que el harness y puede escribir eventos propios antes de terminar.
+var (
+	// ErrIncompleteReport indica que el reporte no llegó a run_end: el programa terminó
+	// (crash, exit o kill) antes de que el harness cerrara la corrida
+	ErrIncompleteReport = errors.New("test report has no run_end")
+	// ErrReportExitMismatch indica que run_end describe una corrida limpia pero el proceso
+	// no terminó con exit code 0
+	ErrReportExitMismatch = errors.New("test report does not match the exit status")
+)
+
+// testReportEvent es una línea del reporte JSON Lines del harness (ver docker/cpp/doctest_main.cpp)
+type testReportEvent struct {
+	Event       string `json:"event"`
+	Name        string `json:"name"`
+	Message     string `json:"message"`
+	Crash       bool   `json:"crash"`
+	Passed      bool   `json:"passed"`
+	DurationNS  int64  `json:"duration_ns"`
+	Allocations int64  `json:"allocations"`
+	Total       int    `json:"total"`
+	Failed      int    `json:"failed"`
+	Aborted     bool   `json:"aborted"`
+
+	// process_end (modo fork por test): cómo terminó el proceso del último test iniciado
+	ExitCode  int   `json:"exit_code"`
+	Signal    int   `json:"signal"`
+	TimedOut  bool  `json:"timed_out"` // El harness lo mató por superar el límite de tiempo por test
+	PeakRSSKB int64 `json:"peak_rss_kb"`
+	WallMS    int64 `json:"wall_ms"`
+}
+
+// testReportCase acumula los eventos de un TEST_CASE
+type testReportCase struct {
+	ended       bool
+	passed      bool
+	durationNS  int64
+	allocations int64
+	messages    []string
+	process     *testReportEvent // process_end del hijo que lo ejecutó (modo fork)
+}
+
+// ParseReport decodifica el reporte del harness evento por evento. Los tests sin case_end
+// quedan fallidos. Si la corrida se detuvo en el primer fallo (fail-fast), los tests que
+// faltan quedan como no ejecutados. En modo fork por test, un process_end describe el
+// proceso del test iniciado justo antes: si murió sin case_end, el test falla con su exit
+// code o señal, o como time_limit_exceeded si el harness lo mató por superar su límite.
+//
+// Un reporte sin run_end (truncado) retorna los resultados parciales junto con
+// ErrIncompleteReport, y uno cuyo run_end no cuadra con exitCode, ErrReportExitMismatch:
+// el llamador decide si los resultados parciales sirven (solo tras un timeout).
+func (p *DoctestParser) ParseReport(report io.Reader, testIDs []string, exitCode int) ([]TestResult, error) {
+	decoder := json.NewDecoder(report)
+	cases := make(map[string]*testReportCase, len(testIDs))
+	var runEnd *testReportEvent
+	var current *testReportCase // último case_start, al que corresponde el próximo process_end
+	events := 0
+
+	for {
+		var event testReportEvent
+		err := decoder.Decode(&event)
+		if err == io.EOF || errors.Is(err, io.ErrUnexpectedEOF) {
+			break
+		}
+		if err != nil {
+			return nil, fmt.Errorf("failed to decode test report: %w", err)
+		}
+		events++
+
+		if event.Event == "run_end" {
+			runEnd = &event
+			continue
+		}
+		if event.Event == "process_end" {
+			if current != nil {
+				current.process = &event
+			}
+			current = nil
+			continue
+		}
+
+		key := normalizeTestIdentifier(event.Name)
+		tc := cases[key]
+		if tc == nil {
+			tc = &testReportCase{}
+			cases[key] = tc
+		}
+
+		switch event.Event {
+		case "case_start":
+			current = tc
+		case "assert", "exception":
+			tc.messages = append(tc.messages, event.Message)
+		case "case_end":
+			tc.ended = true
+			tc.passed = event.Passed
+			tc.durationNS = event.DurationNS
+			tc.allocations = event.Allocations
+		}
+	}
+
+	if events == 0 {
+		return nil, fmt.Errorf("empty test report")
+	}
+
+	aborted := runEnd != nil && runEnd.Aborted
+
+	results := make([]TestResult, 0, len(testIDs))
+	for _, testID := range testIDs {
+		result := TestResult{
+			TestID:   testID,
+			TestName: testID,
+		}
+
+		tc, ok := cases[normalizeTestIdentifier(testID)]
+		switch {
+		case !ok && aborted:
+			result.ErrorMessage = "Test not run (fail-fast stopped at the first failure)"
+		case !ok:
+			result.ErrorMessage = "Test did not run (the program exited before reaching it)"
+		case !tc.ended && tc.process != nil:
+			result.ErrorMessage = describeTestProcessExit(tc.process)
+			if tc.process.TimedOut {
+				result.ErrorType = TestErrorTimeLimitExceeded
+				result.ExecutionTimeMS = tc.process.WallMS
+			} else {
+				result.killed = tc.process.Signal == int(syscall.SIGKILL)
+			}
+		case !tc.ended:
+			result.ErrorMessage = "Test did not finish"
+			result.unfinished = true
+		default:
+			result.Passed = tc.passed
+			result.DurationNS = tc.durationNS
+			result.ExecutionTimeMS = tc.durationNS / int64(time.Millisecond)
+			result.Allocations = tc.allocations
+		}
+
+		if ok && tc.process != nil {
+			result.PeakMemoryKB = tc.process.PeakRSSKB
+		}
+
+		if ok && len(tc.messages) > 0 && !result.Passed {
+			result.ErrorMessage = strings.Join(tc.messages, "\n")
+			if !tc.ended && tc.process != nil {
+				result.ErrorMessage += "\n" + describeTestProcessExit(tc.process)
+			}
+		} else if !result.Passed && result.ErrorMessage == "" {
+			result.ErrorMessage = "Test failed - check output for details"
+		}
+
+		results = append(results, result)
+	}
+
+	if runEnd == nil {
+		return results, ErrIncompleteReport
+	}
+
+	// An aborted run only reaches some of the tests, but never more than expected
+	if runEnd.Total > len(testIDs) || (!aborted && runEnd.Total != len(testIDs)) {
+		return results, fmt.Errorf("test count mismatch: doctest reported %d tests, expected %d", runEnd.Total, len(testIDs))
+	}
+
+	// The harness exits non-zero whenever a test fails, so a clean run_end from a process
+	// that failed or crashed was not written by the harness (or the program died after it)
+	if runEnd.Failed == 0 && !aborted && exitCode != 0 {
+		return results, fmt.Errorf("%w: run_end reports no failures, exit code %d", ErrReportExitMismatch, exitCode)
+	}
+
+	return results, nil
+}
+
+// describeTestProcessExit explica cómo terminó el proceso de un test que no llegó a case_end
+func describeTestProcessExit(process *testReportEvent) string {
+	if process.TimedOut {
+		return fmt.Sprintf("Time limit exceeded: test stopped after %d ms", process.WallMS)
+	}
+	if process.Signal != 0 {
+		return fmt.Sprintf("Test crashed: killed by signal %d (%s)", process.Signal, syscall.Signal(process.Signal))
+	}
+	return fmt.Sprintf("Test process exited with code %d before finishing", process.ExitCode)
+}
@@ -1,6 +1,7 @@
 package docker
 
 import (
+	"errors"
 	"strings"
 	"testing"
 )
@@ -216,3 +217,130 @@ solution.cpp:28: ERROR: CHECK( addOne(-2) == -3 ) is NOT correct!
 		t.Errorf("Expected test %s to pass", results[2].TestID)
 	}
 }
+
+func TestDoctestParser_Parse_TestTimings(t *testing.T) {
+	parser := NewDoctestParser()
+
+	output := `[doctest] doctest version is "2.4.11"
+[coderunner] test-timing duration_ns=1250000 allocations=3 name=test-uuid-1
+===============================================================================
+solution.cpp:27:
+TEST CASE:  test-uuid-2
+
+solution.cpp:28: ERROR: CHECK( addOne(-2) == -3 ) is NOT correct!
+  values: CHECK( 0 == -3 )
+[coderunner] test-timing passed=0 duration_ns=4200 allocations=0 name=test-uuid-2
+
+===============================================================================
+[doctest] test cases: 2 | 1 passed | 1 failed | 0 skipped
+[doctest] assertions: 2 | 1 passed | 1 failed |
+[doctest] Status: FAILURE!
+===============================================================================`
+
+	results, err := parser.Parse(output, []string{"test-uuid-1", "test-uuid-2"})
+	if err != nil {
+		t.Fatalf("Expected no error, got: %v", err)
+	}
+
+	if results[0].DurationNS != 1250000 || results[0].ExecutionTimeMS != 1 || results[0].Allocations != 3 {
+		t.Errorf("Unexpected timing for test-uuid-1: %+v", results[0])
+	}
+	if results[1].DurationNS != 4200 || results[1].Passed {
+		t.Errorf("Unexpected result for test-uuid-2: %+v", results[1])
+	}
+	if strings.Contains(results[1].ErrorMessage, "test-timing") {
+		t.Errorf("Timing line leaked into the failure message: %q", results[1].ErrorMessage)
+	}
+}
+
+func TestDoctestParser_ParseReport(t *testing.T) {
+	parser := NewDoctestParser()
+
+	// The second test crashed: its case_end and the run_end never made it to the report.
+	// The partial results come back, but flagged as incomplete.
+	report := `{"event":"case_start","name":"test-uuid-1"}
+{"event":"case_end","name":"test-uuid-1","passed":true,"duration_ns":2000000,"allocations":5}
+{"event":"case_start","name":"test-uuid-2"}
+{"event":"assert","name":"test-uuid-2","message":"solution.cpp:28: ERROR: CHECK( f() == 1 ) is NOT correct!\n  values: CHECK( 0 == 1 )"}
+{"event":"exception","name":"test-uuid-2","message":"SIGSEGV - Segmentation violation signal","crash":true}
+{"event":"case_end","name":"test-uu`
+
+	results, err := parser.ParseReport(strings.NewReader(report), []string{"test-uuid-1", "test-uuid-2", "test-uuid-3"}, 139)
+	if !errors.Is(err, ErrIncompleteReport) {
+		t.Fatalf("Expected ErrIncompleteReport, got: %v", err)
+	}
+
+	if !results[0].Passed || results[0].DurationNS != 2000000 || results[0].ExecutionTimeMS != 2 || results[0].Allocations != 5 {
+		t.Errorf("Unexpected result for test-uuid-1: %+v", results[0])
+	}
+	if results[1].Passed || !strings.Contains(results[1].ErrorMessage, "SIGSEGV") || !strings.Contains(results[1].ErrorMessage, "values: CHECK( 0 == 1 )") {
+		t.Errorf("Unexpected result for test-uuid-2: %+v", results[1])
+	}
+	if results[2].Passed || results[2].ErrorMessage == "" {
+		t.Errorf("Expected test-uuid-3 to fail as not run: %+v", results[2])
+	}
+
+	if _, err := parser.ParseReport(strings.NewReader(""), []string{"test-uuid-1"}, 0); err == nil {
+		t.Errorf("Expected an error for an empty report")
+	}
+
+	// A clean run_end from a process that did not exit with 0 was not written by the harness
+	forged := `{"event":"case_start","name":"test-uuid-1"}
+{"event":"case_end","name":"test-uuid-1","passed":true,"duration_ns":10,"allocations":0}
+{"event":"run_end","total":1,"failed":0,"aborted":false}`
+	if _, err := parser.ParseReport(strings.NewReader(forged), []string{"test-uuid-1"}, 1); !errors.Is(err, ErrReportExitMismatch) {
+		t.Errorf("Expected ErrReportExitMismatch, got: %v", err)
+	}
+	if _, err := parser.ParseReport(strings.NewReader(forged), []string{"test-uuid-1"}, 0); err != nil {
+		t.Errorf("Expected a clean run to parse, got: %v", err)
+	}
+
+	// Fail-fast: doctest stopped after the first failure, so run_end counts fewer tests
+	aborted := `{"event":"case_start","name":"test-uuid-1"}
+{"event":"case_end","name":"test-uuid-1","passed":false,"duration_ns":10,"allocations":0}
+{"event":"run_end","total":1,"failed":1,"aborted":true}`
+	results, err = parser.ParseReport(strings.NewReader(aborted), []string{"test-uuid-1", "test-uuid-2"}, 1)
+	if err != nil {
+		t.Fatalf("Expected an aborted run to parse, got: %v", err)
+	}
+	if results[1].Passed || !strings.Contains(results[1].ErrorMessage, "fail-fast") {
+		t.Errorf("Expected test-uuid-2 to be reported as not run: %+v", results[1])
+	}
+
+	// Fork per test: the second test's process was killed, the third still ran
+	forked := `{"event":"case_start","name":"test-uuid-1"}
+{"event":"case_end","name":"test-uuid-1","passed":true,"duration_ns":10,"allocations":0}
+{"event":"process_end","exit_code":0,"signal":0,"peak_rss_kb":2048,"user_ms":1,"sys_ms":0,"wall_ms":2}
+{"event":"case_start","name":"test-uuid-2"}
+{"event":"process_end","exit_code":0,"signal":9,"peak_rss_kb":65536,"user_ms":900,"sys_ms":3,"wall_ms":950}
+{"event":"case_start","name":"test-uuid-3"}
+{"event":"case_end","name":"test-uuid-3","passed":true,"duration_ns":10,"allocations":0}
+{"event":"process_end","exit_code":0,"signal":0,"peak_rss_kb":2048,"user_ms":1,"sys_ms":0,"wall_ms":2}
+{"event":"run_end","total":3,"failed":1,"aborted":false}`
+	results, err = parser.ParseReport(strings.NewReader(forked), []string{"test-uuid-1", "test-uuid-2", "test-uuid-3"}, 1)
+	if err != nil {
+		t.Fatalf("Expected a forked run to parse, got: %v", err)
+	}
+	if !results[0].Passed || results[0].PeakMemoryKB != 2048 || !results[2].Passed {
+		t.Errorf("Expected the other tests to pass with their own metrics: %+v", results)
+	}
+	if results[1].Passed || !strings.Contains(results[1].ErrorMessage, "signal 9") || results[1].PeakMemoryKB != 65536 {
+		t.Errorf("Expected test-uuid-2 to be attributed the crash: %+v", results[1])
+	}
+	if results[1].ErrorType != "" || !results[1].killed {
+		t.Errorf("Expected a SIGKILL that is not a time limit: %+v", results[1])
+	}
+
+	// Per-test time limit: the harness killed the second test, the third still ran
+	limited := strings.Replace(forked, `"signal":9,"peak_rss_kb"`, `"signal":9,"timed_out":true,"peak_rss_kb"`, 1)
+	results, err = parser.ParseReport(strings.NewReader(limited), []string{"test-uuid-1", "test-uuid-2", "test-uuid-3"}, 1)
+	if err != nil {
+		t.Fatalf("Expected a run with a time limit to parse, got: %v", err)
+	}
+	if results[1].Passed || results[1].ErrorType != TestErrorTimeLimitExceeded || results[1].ExecutionTimeMS != 950 {
+		t.Errorf("Expected test-uuid-2 to exceed its time limit: %+v", results[1])
+	}
+	if !results[2].Passed {
+		t.Errorf("Expected test-uuid-3 to run after the time limit: %+v", results[2])
+	}
+}
@@ -15,17 +15,61 @@ type ExecutionConfig struct {
 	ExecutionID uuid.UUID
 	TestIDs     []string // IDs de los tests en orden de aparición
 
-	// Resource limits
-	MemoryLimitMB  int64   // Límite de memoria en MB
-	CPULimit       float64 // Límite de CPU (0.5 = 50% de un core)
-	TimeoutSeconds int     // Timeout de ejecución en segundos
+	// Resource limits (run phase)
+	MemoryLimitMB   int64   // Límite de memoria en MB
+	CPULimit        float64 // Límite de CPU (0.5 = 50% de un core)
+	TimeoutSeconds  int     // Timeout de ejecución en segundos
+	FailFast        bool    // Detener la corrida en el primer test fallido
+	TestTimeLimitMS int64   // Límite de tiempo real por TEST_CASE (0 = el de DockerConfig)
+
+	// Compilación separada (opcional): si TestUnit no está vacío, la solución del estudiante
+	// (SolutionUnit) y los tests (TestUnit, que incluye el header Declarations) se compilan
+	// como unidades de traducción distintas y el objeto de los tests se reutiliza desde el
+	// cache de compilación. SourceCode sigue siendo el código completo: de él salen los
+	// TestIDs y la clave del binario en el cache.
+	SolutionUnit string
+	Declarations string
+	TestUnit     string
+
+	// Compiler es el perfil de compilación (compilador, estándar, optimización, sanitizers)
+	Compiler CompilerProfile
+
+	// Resource limits (compile phase)
+	CompileMemoryLimitMB  int64   // Límite de memoria de g++ en MB
+	CompileCPULimit       float64 // Límite de CPU de g++
+	CompileTimeoutSeconds int     // Timeout de compilación en segundos
 
 	// Docker configuration
 	ImageName     string // Nombre de la imagen Docker a usar
 	ContainerName string // Nombre del contenedor (opcional)
 	WorkDir       string // Directorio de trabajo dentro del contenedor
+
+	// Progress recibe eventos de avance mientras se ejecuta (opcional)
+	Progress ProgressFunc
+}
+
+// Fases reportadas en ProgressEvent
+const (
+	PhaseCompiling = "compiling"
+	PhaseCompiled  = "compiled"
+	PhaseRunning   = "running"
+	PhaseTest      = "test"
+)
+
+// ProgressEvent es un evento de avance de una ejecución. Los eventos de test se leen del
+// stdout de la solución mientras corre y son solo informativos: el resultado final sale
+// del reporte del harness.
+type ProgressEvent struct {
+	Phase      string
+	TestID     string // Solo en PhaseTest
+	Passed     bool   // Solo en PhaseTest
+	DurationNS int64  // Solo en PhaseTest
+	Message    string
 }
 
+// ProgressFunc recibe eventos de avance; puede llamarse desde otra goroutine
+type ProgressFunc func(ProgressEvent)
+
 // ExecutionResult representa el resultado de ejecutar código en Docker
 type ExecutionResult struct {
 	// Execution info
@@ -37,6 +81,7 @@ type ExecutionResult struct {
 	StdOut         string
 	StdErr         string
 	CompilationLog string
+	Compiled       bool // La solución compiló (o el binario se tomó del cache)
 
 	// Test results
 	TotalTests  int
@@ -45,8 +90,14 @@ type ExecutionResult struct {
 	TestResults []TestResult
 
 	// Performance metrics
-	ExecutionTimeMS int64
-	MemoryUsageMB   float64
+	ExecutionTimeMS   int64   // Tiempo total (compilación + ejecución + overhead del contenedor)
+	CompilationTimeMS int64   // Tiempo de la fase de compilación (0 si hubo cache hit)
+	RunTimeMS         int64   // Tiempo de la fase de ejecución
+	MemoryUsageMB     float64 // Pico de memoria residente del proceso de la solución (sin el compilador)
+	CPUUserMS         int64   // Tiempo de CPU en modo usuario de la solución
+	CPUSystemMS       int64   // Tiempo de CPU en modo kernel de la solución
+	WallTimeMS        int64   // Tiempo real de la solución, medido alrededor del proceso
+	CompileCacheHit   bool    // El binario se tomó del cache de compilación (sin g++)
 
 	// Error information
 	ErrorType    string
@@ -64,15 +115,49 @@ type TestResult struct {
 	ActualOutput    string
 	ErrorMessage    string
 	ExecutionTimeMS int64
+	DurationNS      int64  // Duración del TEST_CASE medida por el harness (0 si no se reportó)
+	Allocations     int64  // Reservas con operator new durante el TEST_CASE
+	PeakMemoryKB    int64  // Pico de memoria del proceso del test (solo en modo fork por test)
+	ErrorType       string // Vacío o TestErrorTimeLimitExceeded
+
+	// unfinished: el test empezó pero la corrida se cortó antes de que terminara
+	unfinished bool
+	// killed: el proceso del test murió por SIGKILL sin superar su límite de tiempo
+	// (OOM killer o límite de procesos; solo en modo fork por test)
+	killed bool
+}
+
+// LoadDependent indica si el resultado depende de la carga del host y no debe
+// reutilizarse para otro envío idéntico: un timeout (de la ejecución o de algún test) o
+// un proceso muerto por SIGKILL, que suele ser el límite de memoria
+func (r *ExecutionResult) LoadDependent() bool {
+	if r.TimedOut || r.ExitCode == 137 || r.ErrorType == TestErrorTimeLimitExceeded {
+		return true
+	}
+	for _, tr := range r.TestResults {
+		if tr.ErrorType == TestErrorTimeLimitExceeded || tr.killed {
+			return true
+		}
+	}
+	return false
 }
 
+// TestErrorTimeLimitExceeded es el ErrorType de un test que superó su límite de tiempo
+// (el límite por test o el timeout de toda la ejecución mientras corría)
+const TestErrorTimeLimitExceeded = "time_limit_exceeded"
+
 // DockerConfig representa la configuración general de Docker
 type DockerConfig struct {
-	// Default limits
+	// Default limits (run phase)
 	DefaultMemoryMB int64
 	DefaultCPULimit float64
 	DefaultTimeout  time.Duration
 
+	// Default limits (compile phase)
+	CompileMemoryMB int64
+	CompileCPULimit float64
+	CompileTimeout  time.Duration
+
 	// Image names
 	CppImageName    string
 	PythonImageName string
@@ -85,7 +170,30 @@ type DockerConfig struct {
 	// Security settings
 	ReadOnlyRootFS   bool
 	DropCapabilities []string
+	AddCapabilities  []string // SETUID/SETGID: measure baja de root al usuario coderunner
 	SecurityOpt      []string
+
+	// Container pool settings
+	PoolSize    int // Contenedores pre-iniciados (0 = un contenedor por ejecución)
+	PoolMaxUses int // Ejecuciones por contenedor antes de reciclarlo (0 = sin límite)
+
+	// Compile cache settings
+	CompileCacheDir   string // Directorio donde se guardan los binarios compilados
+	CompileCacheMaxMB int64  // Tamaño máximo del cache en MB (0 = deshabilitado)
+
+	// Output settings
+	MaxOutputBytes int64 // stdout + stderr máximos por comando antes de cortarlo (0 = sin límite)
+
+	// Test sharding settings
+	MaxTestShards int  // Procesos que se reparten los tests de un envío (1 = secuencial)
+	ForkPerTest   bool // El harness ejecuta cada TEST_CASE en un proceso hijo (fork)
+
+	// TestTimeLimitMS es el límite de tiempo real por TEST_CASE cuando la petición no
+	// indica uno (0 = sin límite por test, solo el timeout de la ejecución)
+	TestTimeLimitMS int64
+
+	// Workspace settings
+	WorkspaceTmpfsMB int64 // Tamaño del tmpfs del workspace (fuentes, objetos y binario)
 }
 
 // DefaultDockerConfig retorna la configuración por defecto
@@ -95,6 +203,10 @@ func DefaultDockerConfig() *DockerConfig {
 		DefaultCPULimit: 0.5, // 50% de un core
 		DefaultTimeout:  30 * time.Second,
 
+		CompileMemoryMB: 512, // g++ needs more memory than most solutions
+		CompileCPULimit: 1.0, // 1 core
+		CompileTimeout:  30 * time.Second,
+
 		CppImageName:    "coderunner-cpp:latest",
 		PythonImageName: "coderunner-python:latest",
 		JavaImageName:   "coderunner-java:latest",
@@ -104,7 +216,46 @@ func DefaultDockerConfig() *DockerConfig {
 
 		ReadOnlyRootFS:   true,
 		DropCapabilities: []string{"ALL"},
+		AddCapabilities:  []string{"SETUID", "SETGID"},
 		SecurityOpt:      []string{"no-new-privileges"},
+
+		PoolSize:    4,
+		PoolMaxUses: 50,
+
+		CompileCacheDir:   "./compile_cache",
+		CompileCacheMaxMB: 512,
+
+		MaxOutputBytes: 1024 * 1024, // 1 MB
+
+		MaxTestShards: 1,
+
+		WorkspaceTmpfsMB: 64,
+	}
+}
+
+// NativeConfig representa la configuración del runner nativo, que ejecuta los binarios
+// en el host (namespaces + cgroups v2 + seccomp) en lugar de en un contenedor
+type NativeConfig struct {
+	WorkDir    string // Directorio del host donde se crean los workspaces de ejecución
+	CgroupRoot string // Cgroup v2 bajo el cual se crea un cgroup por ejecución
+	UID        int    // Usuario con el que corre la solución (coderunner en la imagen)
+	GID        int    // Grupo con el que corre la solución
+	PidsLimit  int64  // Máximo de procesos/hilos por ejecución
+
+	// WorkspaceTmpfsMB es el tamaño del tmpfs montado en WorkDir si no es ya un tmpfs
+	WorkspaceTmpfsMB int64
+}
+
+// DefaultNativeConfig retorna la configuración por defecto del runner nativo
+func DefaultNativeConfig() *NativeConfig {
+	return &NativeConfig{
+		WorkDir:    "/var/lib/coderunner/native",
+		CgroupRoot: "/sys/fs/cgroup/coderunner",
+		UID:        1000,
+		GID:        1000,
+		PidsLimit:  16,
+
+		WorkspaceTmpfsMB: 256,
 	}
 }
 
@@ -123,8 +274,14 @@ func DefaultExecutionConfig(executionID uuid.UUID, sourceCode string) *Execution
 		MemoryLimitMB:  dockerConfig.DefaultMemoryMB,
 		CPULimit:       dockerConfig.DefaultCPULimit,
 		TimeoutSeconds: int(dockerConfig.DefaultTimeout.Seconds()),
-		ImageName:      dockerConfig.CppImageName,
-		WorkDir:        "/workspace",
+
+		CompileMemoryLimitMB:  dockerConfig.CompileMemoryMB,
+		CompileCPULimit:       dockerConfig.CompileCPULimit,
+		CompileTimeoutSeconds: int(dockerConfig.CompileTimeout.Seconds()),
+		Compiler:              DefaultCompilerProfile(),
+
+		ImageName: dockerConfig.CppImageName,
+		WorkDir:   "/workspace",
 	}
 }
 
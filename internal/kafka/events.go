@@ -95,7 +95,11 @@ type ExecutionMetricsEvent struct {
 
 	// Métricas de rendimiento
 	ExecutionTimeMS int64   `json:"execution_time_ms"`
-	MemoryUsageMB   float64 `json:"memory_usage_mb,omitempty"`
+	QueueWaitMS     int64   `json:"queue_wait_ms"`             // Tiempo esperando un slot de ejecución
+	MemoryUsageMB   float64 `json:"memory_usage_mb,omitempty"` // Pico de memoria de la solución
+	CPUUserMS       int64   `json:"cpu_user_ms,omitempty"`     // CPU en modo usuario de la solución
+	CPUSystemMS     int64   `json:"cpu_system_ms,omitempty"`   // CPU en modo kernel de la solución
+	WallTimeMS      int64   `json:"wall_time_ms,omitempty"`    // Tiempo real de la solución
 	ExitCode        int     `json:"exit_code,omitempty"`
 
 	// Resultados de tests
@@ -129,7 +133,11 @@ type TestResultMetric struct {
 	TestName        string `json:"test_name,omitempty"`
 	Passed          bool   `json:"passed"`
 	ExecutionTimeMS int64  `json:"execution_time_ms,omitempty"`
+	DurationNS      int64  `json:"duration_ns,omitempty"`    // Duración medida por el harness
+	Allocations     int64  `json:"allocations,omitempty"`    // Reservas con operator new durante el test
+	PeakMemoryKB    int64  `json:"peak_memory_kb,omitempty"` // Pico de memoria del proceso del test (fork por test)
 	ErrorMessage    string `json:"error_message,omitempty"`
+	ErrorType       string `json:"error_type,omitempty"` // time_limit_exceeded si superó su límite de tiempo
 }
 
 // PublishExecutionMetrics publica métricas detalladas de ejecución a Kafka
@@ -9,9 +9,13 @@ import (
 	"time"
 
 	"code-runner/env"
+	"code-runner/internal/tracing"
 
 	"github.com/segmentio/kafka-go"
 	"github.com/segmentio/kafka-go/sasl/plain"
+	"go.opentelemetry.io/otel"
+	"go.opentelemetry.io/otel/attribute"
+	"go.opentelemetry.io/otel/trace"
 )
 
 // KafkaClient wraps Kafka producer and consumer functionality
@@ -195,6 +199,13 @@ func (kc *KafkaClient) ProduceMessage(ctx context.Context, topic string, key str
 		return fmt.Errorf("topic cannot be empty")
 	}
 
+	ctx, span := tracing.Start(ctx, "publish "+topic,
+		trace.WithSpanKind(trace.SpanKindProducer),
+		trace.WithAttributes(
+			attribute.String("messaging.system", "kafka"),
+			attribute.String("messaging.destination.name", topic),
+		))
+
 	message := kafka.Message{
 		Topic: topic,
 		Key:   []byte(key),
@@ -202,7 +213,11 @@ func (kc *KafkaClient) ProduceMessage(ctx context.Context, topic string, key str
 		Time:  time.Now(),
 	}
 
+	// Propagate the trace context to consumers through the message headers
+	otel.GetTextMapPropagator().Inject(ctx, (*headerCarrier)(&message.Headers))
+
 	err := kc.writer.WriteMessages(ctx, message)
+	tracing.End(span, err)
 	if err != nil {
 		return fmt.Errorf("failed to write message to topic %s: %w", topic, err)
 	}
@@ -0,0 +1,37 @@
+package kafka
+
+import "github.com/segmentio/kafka-go"
+
+// headerCarrier adapts Kafka message headers to propagation.TextMapCarrier so the trace
+// context (traceparent) travels with each message to its consumers
+type headerCarrier []kafka.Header
+
+// Get returns the value of the first header with the given key
+func (c *headerCarrier) Get(key string) string {
+	for _, header := range *c {
+		if header.Key == key {
+			return string(header.Value)
+		}
+	}
+	return ""
+}
+
+// Set replaces the header with the given key, or appends it
+func (c *headerCarrier) Set(key, value string) {
+	for i, header := range *c {
+		if header.Key == key {
+			(*c)[i].Value = []byte(value)
+			return
+		}
+	}
+	*c = append(*c, kafka.Header{Key: key, Value: []byte(value)})
+}
+
+// Keys returns the keys of all headers
+func (c *headerCarrier) Keys() []string {
+	keys := make([]string, 0, len(*c))
+	for _, header := range *c {
+		keys = append(keys, header.Key)
+	}
+	return keys
+}
@@ -0,0 +1,69 @@
+package metrics
+
+import (
+	"time"
+
+	"github.com/prometheus/client_golang/prometheus"
+	"github.com/prometheus/client_golang/prometheus/promauto"
+)
+
+// Etapas de una ejecución medidas en coderunner_stage_duration_seconds
+const (
+	StageQueueWait          = "queue_wait"          // Espera de un slot del scheduler
+	StageDBInsert           = "db_insert"           // Registro de la ejecución
+	StageTemplateGeneration = "template_generation" // Template C++ con doctest (incluye guardarlo)
+	StageImageCheck         = "image_check"         // Inspección (o build) de la imagen
+	StageContainerAcquire   = "container_acquire"   // Contenedor del pool o uno dedicado
+	StageContainerCreate    = "container_create"    // ContainerCreate + ContainerStart
+	StageCompile            = "compile"
+	StageRun                = "run"
+	StageLogCapture         = "log_capture" // Lectura de stats y reportes de tests del contenedor
+	StageParse              = "parse"       // Parseo de resultados y clasificación de errores
+	StageDBUpdate           = "db_update"
+	StageKafkaPublish       = "kafka_publish"
+)
+
+// stageBuckets cubre desde una etapa en memoria (1ms) hasta una compilación o corrida
+// al límite de su timeout
+var stageBuckets = []float64{0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10, 30, 60}
+
+var (
+	// StageDuration es la duración de cada etapa de una ejecución
+	StageDuration = promauto.NewHistogramVec(prometheus.HistogramOpts{
+		Name:    "coderunner_stage_duration_seconds",
+		Help:    "Duration of each stage of an execution.",
+		Buckets: stageBuckets,
+	}, []string{"stage"})
+
+	// ExecutionsInFlight cuenta las peticiones admitidas por estado (running o queued)
+	ExecutionsInFlight = promauto.NewGaugeVec(prometheus.GaugeOpts{
+		Name: "coderunner_executions_in_flight",
+		Help: "Admitted executions by state (running holds a slot, queued waits for one).",
+	}, []string{"state"})
+
+	// Containers cuenta los contenedores sandbox por estado (in_use o idle en el pool)
+	Containers = promauto.NewGaugeVec(prometheus.GaugeOpts{
+		Name: "coderunner_containers",
+		Help: "Sandbox containers by state (in_use by an execution, idle in the pool).",
+	}, []string{"state"})
+
+	// ExecutionsTotal cuenta las ejecuciones terminadas por ErrorType ("none" si no hubo error)
+	ExecutionsTotal = promauto.NewCounterVec(prometheus.CounterOpts{
+		Name: "coderunner_executions_total",
+		Help: "Finished executions by error type (none when the execution had no error).",
+	}, []string{"error_type"})
+)
+
+// ObserveStage registra en StageDuration el tiempo transcurrido desde start. Pensado
+// para defer: defer metrics.ObserveStage(metrics.StageCompile, time.Now())
+func ObserveStage(stage string, start time.Time) {
+	StageDuration.WithLabelValues(stage).Observe(time.Since(start).Seconds())
+}
+
+// RecordExecution cuenta una ejecución terminada con el errorType dado
+func RecordExecution(errorType string) {
+	if errorType == "" {
+		errorType = "none"
+	}
+	ExecutionsTotal.WithLabelValues(errorType).Inc()
+}
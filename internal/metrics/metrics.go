@@ -0,0 +1,15 @@
+// Package metrics define las métricas del servicio sobre prometheus/client_golang. Se
+// registran en el registro por defecto, que además trae los collectors del proceso y del
+// runtime de Go (process_*, go_*), y Handler las sirve en el formato de Prometheus.
+package metrics
+
+import (
+	"net/http"
+
+	"github.com/prometheus/client_golang/prometheus/promhttp"
+)
+
+// Handler sirve todas las métricas registradas (GET /metrics)
+func Handler() http.Handler {
+	return promhttp.Handler()
+}
@@ -0,0 +1,258 @@
+package server
+
+import (
+	"context"
+	"crypto/sha256"
+	"encoding/binary"
+	"encoding/hex"
+	"log"
+	"strconv"
+	"sync"
+	"time"
+
+	"google.golang.org/grpc/codes"
+	"google.golang.org/grpc/status"
+
+	pb "code-runner/api/gen/proto"
+	"code-runner/internal/docker"
+	"code-runner/internal/types"
+)
+
+// batchGroup agrupa los envíos de un lote con el mismo código y los mismos tests;
+// se ejecuta solo el primero y su resultado se registra también para el resto
+type batchGroup struct {
+	requests     []*pb.ExecutionRequest
+	internalReqs []*types.ExecutionRequest
+	indexes      []int
+}
+
+// batchItemResult son las respuestas de un grupo (en el orden de indexes) listas para
+// enviarse por el stream
+type batchItemResult struct {
+	group     *batchGroup
+	responses []*pb.ExecutionResponse
+}
+
+// EvaluateSolutionsBatch evalúa muchos envíos en una sola llamada (por ejemplo, recalificar
+// una cohorte). Los envíos con código y tests idénticos se ejecutan una sola vez, el lote
+// se reparte entre tantos workers como slots de ejecución y los resultados se envían en
+// orden de finalización. Un envío inválido o fallido no aborta el lote: su resultado
+// lleva el error en la respuesta.
+func (s *solutionEvaluationServiceImpl) EvaluateSolutionsBatch(req *pb.BatchExecutionRequest, stream pb.SolutionEvaluationService_EvaluateSolutionsBatchServer) error {
+	submissions := req.GetSubmissions()
+	log.Printf("📦 ===== RECEIVED BATCH EXECUTION REQUEST =====")
+	log.Printf("  📦 Submissions: %d", len(submissions))
+
+	if len(submissions) == 0 {
+		return status.Error(codes.InvalidArgument, "batch must contain at least one submission")
+	}
+	if s.batchMaxSubmissions > 0 && len(submissions) > s.batchMaxSubmissions {
+		return status.Errorf(codes.InvalidArgument, "batch has %d submissions, the maximum is %d", len(submissions), s.batchMaxSubmissions)
+	}
+
+	ctx, cancel := context.WithCancel(stream.Context())
+	defer cancel()
+	startTime := time.Now()
+
+	// Validate every submission and group identical ones; invalid submissions are
+	// answered right away
+	var groups []*batchGroup
+	byKey := make(map[string]*batchGroup)
+	for i, submission := range submissions {
+		internalReq, err := s.parseAndValidateRequest(ctx, submission)
+		if err != nil {
+			if err := stream.Send(batchErrorResult(i, submission, "invalid_request", err)); err != nil {
+				return err
+			}
+			continue
+		}
+
+		key := batchDedupKey(submission)
+		if group, ok := byKey[key]; ok {
+			group.requests = append(group.requests, submission)
+			group.internalReqs = append(group.internalReqs, internalReq)
+			group.indexes = append(group.indexes, i)
+			continue
+		}
+		group := &batchGroup{requests: []*pb.ExecutionRequest{submission}, internalReqs: []*types.ExecutionRequest{internalReq}, indexes: []int{i}}
+		byKey[key] = group
+		groups = append(groups, group)
+	}
+
+	log.Printf("  🧬 Unique submissions: %d (%d deduplicated)", len(groups), len(submissions)-len(groups))
+
+	// Each worker holds at most one place in the execution queue, so interactive
+	// EvaluateSolution requests keep the rest of the queue
+	workers := cap(s.scheduler.slots)
+	if workers > len(groups) {
+		workers = len(groups)
+	}
+
+	pending := make(chan *batchGroup)
+	results := make(chan batchItemResult)
+	var wg sync.WaitGroup
+	for w := 0; w < workers; w++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for group := range pending {
+				responses := s.evaluateBatchGroup(ctx, group)
+				select {
+				case results <- batchItemResult{group: group, responses: responses}:
+				case <-ctx.Done():
+					return
+				}
+			}
+		}()
+	}
+
+	go func() {
+		defer close(pending)
+		for _, group := range groups {
+			select {
+			case pending <- group:
+			case <-ctx.Done():
+				return
+			}
+		}
+	}()
+
+	go func() {
+		wg.Wait()
+		close(results)
+	}()
+
+	// Only this goroutine sends on the stream
+	sent := 0
+	for item := range results {
+		for n, index := range item.group.indexes {
+			result := &pb.BatchExecutionResult{
+				Index:        int32(index),
+				StudentId:    submissions[index].GetStudentId(),
+				Response:     item.responses[n],
+				Deduplicated: n > 0,
+			}
+			if err := stream.Send(result); err != nil {
+				log.Printf("❌ Failed to send batch result, cancelling batch: %v", err)
+				cancel()
+				for range results {
+				}
+				return err
+			}
+			sent++
+		}
+	}
+
+	if err := ctx.Err(); err != nil {
+		return status.FromContextError(err).Err()
+	}
+
+	log.Printf("✅ ===== BATCH COMPLETED =====")
+	log.Printf("  ⏱️  Total batch time: %d ms", time.Since(startTime).Milliseconds())
+	log.Printf("  📦 Results sent: %d (executions: %d)", sent, len(groups))
+	return nil
+}
+
+// evaluateBatchGroup ejecuta el envío representativo de un grupo, esperando turno en el
+// scheduler en lugar de ser rechazado cuando la cola está llena. Cada envío del grupo
+// tiene su propio registro de ejecución y su evento en Kafka; los duplicados reutilizan
+// el resultado del representativo, como los aciertos del cache de resultados.
+func (s *solutionEvaluationServiceImpl) evaluateBatchGroup(ctx context.Context, group *batchGroup) []*pb.ExecutionResponse {
+	responses := make([]*pb.ExecutionResponse, len(group.indexes))
+	startTime := time.Now()
+
+	ticket, err := s.scheduler.admitWait(ctx)
+	if err != nil {
+		for n, index := range group.indexes {
+			responses[n] = batchErrorResult(index, group.requests[n], "cancelled", err).Response
+		}
+		return responses
+	}
+	defer ticket.release()
+
+	execution, dockerResult, err := s.executeAdmitted(ctx, group.internalReqs[0], ticket, nil)
+	if err != nil {
+		log.Printf("❌ Batch submission %d failed: %v", group.indexes[0], err)
+		for n, index := range group.indexes {
+			responses[n] = batchErrorResult(index, group.requests[n], "execution_error", err).Response
+		}
+		return responses
+	}
+
+	for n, index := range group.indexes {
+		var response *pb.ExecutionResponse
+		if n == 0 {
+			response, err = s.completeExecution(ctx, group.requests[0], group.internalReqs[0], execution, dockerResult, ticket.queueWait, startTime)
+		} else {
+			response, err = s.completeDuplicate(ctx, group.requests[n], group.internalReqs[n], dockerResult, ticket.queueWait, startTime)
+		}
+		if err != nil {
+			log.Printf("❌ Batch submission %d failed: %v", index, err)
+			response = batchErrorResult(index, group.requests[n], "execution_error", err).Response
+		}
+		responses[n] = response
+	}
+	return responses
+}
+
+// completeDuplicate registra un envío deduplicado con el resultado ya obtenido para su
+// grupo: crea su registro de ejecución y su template, y publica su evento en Kafka
+func (s *solutionEvaluationServiceImpl) completeDuplicate(ctx context.Context, req *pb.ExecutionRequest, internalReq *types.ExecutionRequest, dockerResult *docker.ExecutionResult, queueWait time.Duration, startTime time.Time) (*pb.ExecutionResponse, error) {
+	execution, err := s.createExecutionRecord(ctx, internalReq)
+	if err != nil {
+		return nil, err
+	}
+	if _, err := s.generateTemplate(ctx, internalReq, execution); err != nil {
+		return nil, err
+	}
+
+	if dockerResult != nil {
+		result := *dockerResult
+		result.ExecutionID = execution.ID
+		dockerResult = &result
+	}
+	return s.completeExecution(ctx, req, internalReq, execution, dockerResult, queueWait, startTime)
+}
+
+// batchErrorResult construye el resultado de un envío que no pudo evaluarse
+func batchErrorResult(index int, submission *pb.ExecutionRequest, errorType string, err error) *pb.BatchExecutionResult {
+	return &pb.BatchExecutionResult{
+		Index:     int32(index),
+		StudentId: submission.GetStudentId(),
+		Response: &pb.ExecutionResponse{
+			Completed:    false,
+			TotalTests:   int32(len(submission.GetTests())),
+			FailedTests:  int32(len(submission.GetTests())),
+			Success:      false,
+			Message:      "Submission could not be evaluated",
+			ErrorMessage: err.Error(),
+			ErrorType:    errorType,
+		},
+	}
+}
+
+// batchDedupKey identifica envíos que producen el mismo resultado: mismo lenguaje,
+// código, tests, modo fail-fast, perfil de compilación y límite de tiempo por test. Cada
+// campo va precedido de su longitud para que no haya ambigüedad.
+func batchDedupKey(req *pb.ExecutionRequest) string {
+	hash := sha256.New()
+	write := func(value string) {
+		var length [8]byte
+		binary.BigEndian.PutUint64(length[:], uint64(len(value)))
+		hash.Write(length[:])
+		hash.Write([]byte(value))
+	}
+
+	write(mapProtoLanguage(req.GetLanguage()))
+	write(req.GetCode())
+	write(strconv.FormatBool(req.GetFailFast()))
+	write(convertCompilerProfile(req.GetCompilerProfile()).String())
+	write(strconv.Itoa(int(req.GetTestTimeLimitMs())))
+	for _, tc := range req.GetTests() {
+		write(tc.GetCodeVersionTestId())
+		write(tc.GetInput())
+		write(tc.GetExpectedOutput())
+		write(tc.GetCustomValidationCode())
+	}
+	return hex.EncodeToString(hash.Sum(nil))
+}
@@ -0,0 +1,43 @@
+package server
+
+import (
+	"testing"
+
+	pb "code-runner/api/gen/proto"
+)
+
+func TestBatchDedupKey_IgnoresStudentButNotTests(t *testing.T) {
+	tests := []*pb.TestCase{{CodeVersionTestId: "t1", Input: "1", ExpectedOutput: "2"}}
+	a := &pb.ExecutionRequest{StudentId: "a", Code: "int f() { return 1; }", Tests: tests}
+	b := &pb.ExecutionRequest{StudentId: "b", Code: "int f() { return 1; }", Tests: tests}
+
+	if batchDedupKey(a) != batchDedupKey(b) {
+		t.Error("Expected identical code and tests from different students to share a key")
+	}
+
+	c := &pb.ExecutionRequest{Code: a.Code, Tests: []*pb.TestCase{{CodeVersionTestId: "t1", Input: "1", ExpectedOutput: "3"}}}
+	if batchDedupKey(a) == batchDedupKey(c) {
+		t.Error("Expected different expected outputs to produce different keys")
+	}
+
+	failFast := &pb.ExecutionRequest{Code: a.Code, Tests: tests, FailFast: true}
+	if batchDedupKey(a) == batchDedupKey(failFast) {
+		t.Error("Expected fail-fast submissions not to share results with full runs")
+	}
+
+	optimized := &pb.ExecutionRequest{Code: a.Code, Tests: tests, CompilerProfile: &pb.CompilerProfile{Optimization: "O2"}}
+	if batchDedupKey(a) == batchDedupKey(optimized) {
+		t.Error("Expected submissions with another compiler profile not to share results")
+	}
+	explicitDefault := &pb.ExecutionRequest{Code: a.Code, Tests: tests, CompilerProfile: &pb.CompilerProfile{Compiler: "gcc"}}
+	if batchDedupKey(a) != batchDedupKey(explicitDefault) {
+		t.Error("Expected an explicit default profile to share results with an empty one")
+	}
+
+	// Field boundaries must not be ambiguous
+	d := &pb.ExecutionRequest{Code: "ab", Tests: []*pb.TestCase{{CodeVersionTestId: "c"}}}
+	e := &pb.ExecutionRequest{Code: "a", Tests: []*pb.TestCase{{CodeVersionTestId: "bc"}}}
+	if batchDedupKey(d) == batchDedupKey(e) {
+		t.Error("Expected shifted field boundaries to produce different keys")
+	}
+}
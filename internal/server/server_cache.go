@@ -0,0 +1,141 @@
+package server
+
+import (
+	"context"
+	"crypto/sha256"
+	"encoding/hex"
+	"log"
+	"strconv"
+	"sync"
+	"time"
+
+	"code-runner/internal/database/models"
+	"code-runner/internal/docker"
+)
+
+// resultCache memoriza resultados de ejecución por template generado (TestCode).
+// Un mismo template siempre produce el mismo resultado salvo timeouts y muertes por
+// memoria, que dependen de la carga del host y nunca se memorizan, por lo que
+// reintentos y doble clic pueden reutilizar la ejecución anterior sin tocar Docker.
+// Las peticiones idénticas concurrentes esperan a la primera en lugar de ejecutarse en paralelo.
+type resultCache struct {
+	ttl time.Duration
+
+	mu      sync.Mutex
+	entries map[string]*resultCacheEntry
+}
+
+// resultCacheEntry es un resultado memorizado o una ejecución en curso
+type resultCacheEntry struct {
+	done      chan struct{} // se cierra cuando la ejecución en curso termina
+	result    *docker.ExecutionResult
+	expiresAt time.Time
+}
+
+// newResultCache crea un cache de resultados con el TTL dado
+func newResultCache(ttl time.Duration) *resultCache {
+	return &resultCache{
+		ttl:     ttl,
+		entries: make(map[string]*resultCacheEntry),
+	}
+}
+
+// resultCacheKey calcula la clave de memoización de un template generado. Una corrida
+// fail-fast, con otro perfil de compilación o con otro límite de tiempo por test produce
+// otro resultado, por lo que no comparten entrada.
+func resultCacheKey(testCode string, options executionOptions) string {
+	hash := sha256.New()
+	hash.Write([]byte(testCode))
+	if options.failFast {
+		hash.Write([]byte("\x00fail-fast"))
+	}
+	hash.Write([]byte("\x00" + options.compiler.String()))
+	if options.testTimeLimitMS > 0 {
+		hash.Write([]byte("\x00test-time-limit=" + strconv.FormatInt(options.testTimeLimitMS, 10)))
+	}
+	return hex.EncodeToString(hash.Sum(nil))
+}
+
+// begin busca un resultado memorizado para la clave. Si existe (o una petición idéntica
+// en curso lo produce) lo retorna; si no, retorna una función store que el llamador debe
+// invocar con el resultado de su ejecución (nil si falló) para liberar a quienes esperan.
+func (c *resultCache) begin(ctx context.Context, key string) (*docker.ExecutionResult, func(*docker.ExecutionResult)) {
+	c.mu.Lock()
+	entry, ok := c.entries[key]
+	if ok && entry.expired(time.Now()) {
+		delete(c.entries, key)
+		ok = false
+	}
+	if !ok {
+		entry = &resultCacheEntry{done: make(chan struct{})}
+		c.entries[key] = entry
+		c.mu.Unlock()
+		return nil, func(result *docker.ExecutionResult) { c.finish(key, entry, result) }
+	}
+	c.mu.Unlock()
+
+	select {
+	case <-entry.done:
+	case <-ctx.Done():
+		return nil, func(*docker.ExecutionResult) {}
+	}
+
+	if entry.result == nil {
+		// The identical request failed or was not cacheable: run it again ourselves
+		return nil, func(*docker.ExecutionResult) {}
+	}
+	return entry.result, nil
+}
+
+// finish guarda el resultado de una ejecución y despierta a las peticiones en espera
+func (c *resultCache) finish(key string, entry *resultCacheEntry, result *docker.ExecutionResult) {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+
+	now := time.Now()
+	if result != nil && !result.LoadDependent() {
+		entry.result = result
+		entry.expiresAt = now.Add(c.ttl)
+	} else if c.entries[key] == entry {
+		delete(c.entries, key)
+	}
+	close(entry.done)
+
+	// Drop expired entries so the map does not grow without bound
+	for k, e := range c.entries {
+		if e.expired(now) {
+			delete(c.entries, k)
+		}
+	}
+}
+
+// expired indica si la entrada ya terminó y superó su TTL
+func (e *resultCacheEntry) expired(now time.Time) bool {
+	select {
+	case <-e.done:
+		return now.After(e.expiresAt)
+	default:
+		return false
+	}
+}
+
+// executeWithResultCache ejecuta el template en Docker, reutilizando un resultado
+// memorizado cuando el cache de resultados está habilitado. Un resultado memorizado
+// no ocupa un slot de ejecución.
+func (s *solutionEvaluationServiceImpl) executeWithResultCache(ctx context.Context, execution *models.Execution, generatedTemplate *models.GeneratedTestCode, ticket *executionTicket, options executionOptions) (*docker.ExecutionResult, error) {
+	if s.resultCache == nil || s.executor == nil {
+		return s.runWhenScheduled(ctx, execution, generatedTemplate, ticket, options)
+	}
+
+	cached, store := s.resultCache.begin(ctx, resultCacheKey(generatedTemplate.TestCode, options))
+	if cached != nil {
+		log.Printf("🗃️  Reusing memoized result for identical template (Docker execution skipped)")
+		result := *cached
+		result.ExecutionID = execution.ID
+		return &result, nil
+	}
+
+	dockerResult, err := s.runWhenScheduled(ctx, execution, generatedTemplate, ticket, options)
+	store(dockerResult)
+	return dockerResult, err
+}
@@ -0,0 +1,96 @@
+package server
+
+import (
+	"context"
+	"testing"
+	"time"
+
+	"code-runner/internal/docker"
+)
+
+func TestResultCache_MemoizesNonTimeoutResults(t *testing.T) {
+	cache := newResultCache(time.Minute)
+	key := resultCacheKey("TEST_CASE(\"a\") {}", executionOptions{})
+
+	cached, store := cache.begin(context.Background(), key)
+	if cached != nil || store == nil {
+		t.Fatalf("Expected a miss on an empty cache")
+	}
+	store(&docker.ExecutionResult{Success: true, PassedTests: 1, TotalTests: 1})
+
+	cached, _ = cache.begin(context.Background(), key)
+	if cached == nil || !cached.Success || cached.PassedTests != 1 {
+		t.Fatalf("Expected the stored result, got %+v", cached)
+	}
+}
+
+func TestResultCache_SkipsTimeouts(t *testing.T) {
+	cache := newResultCache(time.Minute)
+	key := resultCacheKey("while (true) {}", executionOptions{})
+
+	_, store := cache.begin(context.Background(), key)
+	store(&docker.ExecutionResult{TimedOut: true, ErrorType: "timeout"})
+
+	if cached, _ := cache.begin(context.Background(), key); cached != nil {
+		t.Errorf("Expected timeouts not to be memoized")
+	}
+}
+
+func TestResultCache_SkipsLoadDependentResults(t *testing.T) {
+	results := map[string]*docker.ExecutionResult{
+		"time limit": {ErrorType: docker.TestErrorTimeLimitExceeded},
+		"one test over its limit": {TestResults: []docker.TestResult{
+			{TestID: "a", Passed: true},
+			{TestID: "b", ErrorType: docker.TestErrorTimeLimitExceeded},
+		}},
+		"out of memory": {ExitCode: 137, ErrorType: "execution_error"},
+	}
+
+	cache := newResultCache(time.Minute)
+	for name, result := range results {
+		key := resultCacheKey(name, executionOptions{})
+		_, store := cache.begin(context.Background(), key)
+		store(result)
+
+		if cached, _ := cache.begin(context.Background(), key); cached != nil {
+			t.Errorf("%s: expected the result not to be memoized", name)
+		}
+	}
+}
+
+func TestResultCache_ConcurrentRequestWaitsForFirst(t *testing.T) {
+	cache := newResultCache(time.Minute)
+	key := resultCacheKey("int main() {}", executionOptions{})
+
+	_, store := cache.begin(context.Background(), key)
+
+	got := make(chan *docker.ExecutionResult)
+	go func() {
+		cached, _ := cache.begin(context.Background(), key)
+		got <- cached
+	}()
+
+	store(&docker.ExecutionResult{Success: true})
+
+	select {
+	case cached := <-got:
+		if cached == nil || !cached.Success {
+			t.Errorf("Expected the waiting request to reuse the first result, got %+v", cached)
+		}
+	case <-time.After(time.Second):
+		t.Fatalf("Waiting request was not released")
+	}
+}
+
+func TestResultCache_ExpiresAfterTTL(t *testing.T) {
+	cache := newResultCache(time.Millisecond)
+	key := resultCacheKey("int main() {}", executionOptions{})
+
+	_, store := cache.begin(context.Background(), key)
+	store(&docker.ExecutionResult{Success: true})
+	time.Sleep(5 * time.Millisecond)
+
+	if cached, _ := cache.begin(context.Background(), key); cached != nil {
+		t.Errorf("Expected the result to expire after the TTL")
+	}
+}
@@ -6,6 +6,7 @@ import (
 	"os"
 	"os/signal"
 	"syscall"
+	"time"
 
 	"google.golang.org/grpc"
 	"google.golang.org/grpc/reflection"
@@ -16,6 +17,7 @@ import (
 	"code-runner/internal/docker"
 	"code-runner/internal/kafka"
 	template "code-runner/internal/template/cpp"
+	"code-runner/internal/tracing"
 )
 
 // solutionEvaluationServiceImpl implementa el servicio gRPC
@@ -24,34 +26,58 @@ type solutionEvaluationServiceImpl struct {
 	executionRepo         *repository.ExecutionRepository
 	generatedTestCodeRepo *repository.GeneratedTestCodeRepository
 	templateGenerator     *template.CppTemplateGenerator
-	dockerExecutor        *docker.DockerExecutor
+	executor              docker.Executor
 	kafkaClient           *kafka.KafkaClient
+	resultCache           *resultCache
+	scheduler             *executionScheduler
+	batchMaxSubmissions   int
 }
 
-// NewSolutionEvaluationServiceServer crea una nueva instancia del servicio
-func NewSolutionEvaluationServiceServer(db *gorm.DB, kafkaClient *kafka.KafkaClient) pb.SolutionEvaluationServiceServer {
+// ServerOptions agrupa la configuración opcional del servicio
+type ServerOptions struct {
+	ResultCacheEnabled  bool          // Reutiliza resultados de templates idénticos
+	ResultCacheTTL      time.Duration // Tiempo de vida de un resultado memorizado
+	ExecutionSlots      int           // Ejecuciones simultáneas en Docker
+	QueueSize           int           // Peticiones que pueden esperar un slot antes de rechazar
+	BatchMaxSubmissions int           // Envíos máximos por llamada a EvaluateSolutionsBatch (0 = sin límite)
+}
+
+// NewSolutionEvaluationServiceServer crea una nueva instancia del servicio.
+// executor es compartido con main (que prepara imágenes y el pool de contenedores) y puede
+// ser un DockerExecutor o un NativeExecutor; si es nil la ejecución se omite.
+func NewSolutionEvaluationServiceServer(db *gorm.DB, kafkaClient *kafka.KafkaClient, executor docker.Executor, options ServerOptions) pb.SolutionEvaluationServiceServer {
 	executionRepo := repository.NewExecutionRepository(db)
 	generatedTestCodeRepo := repository.NewGeneratedTestCodeRepository(db)
 	templateGenerator := template.NewCppTemplateGenerator(generatedTestCodeRepo)
 
-	// Crear Docker executor
-	dockerExecutor, err := docker.NewDockerExecutor()
-	if err != nil {
-		log.Printf("⚠️  Warning: Failed to create Docker executor: %v", err)
+	if executor == nil {
+		log.Printf("⚠️  Warning: Docker executor not provided")
 		log.Printf("⚠️  Docker execution will not be available. Make sure Docker is running.")
 	}
 
+	var cache *resultCache
+	if options.ResultCacheEnabled && options.ResultCacheTTL > 0 {
+		cache = newResultCache(options.ResultCacheTTL)
+		log.Printf("🗃️  Result memoization enabled (TTL: %s)", options.ResultCacheTTL)
+	}
+
+	scheduler := newExecutionScheduler(options.ExecutionSlots, options.QueueSize)
+	log.Printf("🎛️  Execution scheduler: %d slots, queue of %d", cap(scheduler.slots), cap(scheduler.admitted)-cap(scheduler.slots))
+
 	return &solutionEvaluationServiceImpl{
 		executionRepo:         executionRepo,
 		generatedTestCodeRepo: generatedTestCodeRepo,
 		templateGenerator:     templateGenerator,
-		dockerExecutor:        dockerExecutor,
+		executor:              executor,
 		kafkaClient:           kafkaClient,
+		resultCache:           cache,
+		scheduler:             scheduler,
+		batchMaxSubmissions:   options.BatchMaxSubmissions,
 	}
 }
 
 // StartServer inicia el servidor gRPC
-func StartServer(port string, db *gorm.DB, kafkaClient *kafka.KafkaClient) error {
+func StartServer(port string, db *gorm.DB, kafkaClient *kafka.KafkaClient, executor docker.Executor, options ServerOptions) error {
 	// Create listener
 	lis, err := net.Listen("tcp", ":"+port)
 	if err != nil {
@@ -65,6 +91,8 @@ func StartServer(port string, db *gorm.DB, kafkaClient *kafka.KafkaClient) error
 	serverOptions := []grpc.ServerOption{
 		grpc.MaxRecvMsgSize(maxMsgSize),
 		grpc.MaxSendMsgSize(maxMsgSize),
+		grpc.ChainUnaryInterceptor(tracing.UnaryServerInterceptor()),
+		grpc.ChainStreamInterceptor(tracing.StreamServerInterceptor()),
 	}
 
 	// Create gRPC server
@@ -72,7 +100,7 @@ func StartServer(port string, db *gorm.DB, kafkaClient *kafka.KafkaClient) error
 	log.Printf("✅ gRPC server created")
 
 	// Register service
-	service := NewSolutionEvaluationServiceServer(db, kafkaClient)
+	service := NewSolutionEvaluationServiceServer(db, kafkaClient, executor, options)
 	pb.RegisterSolutionEvaluationServiceServer(grpcServer, service)
 	log.Printf("✅ Service registered")
 
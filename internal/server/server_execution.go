@@ -5,17 +5,33 @@ import (
 	"fmt"
 	"log"
 	"os"
+	"strings"
 	"time"
 
+	"go.opentelemetry.io/otel/attribute"
+	"go.opentelemetry.io/otel/trace"
+	"google.golang.org/grpc/status"
+
 	"code-runner/internal/database/models"
 	"code-runner/internal/docker"
 	"code-runner/internal/kafka"
+	"code-runner/internal/metrics"
+	"code-runner/internal/tracing"
 	"code-runner/internal/types"
 )
 
-// executeInDocker ejecuta el código en un contenedor Docker
-func (s *solutionEvaluationServiceImpl) executeInDocker(ctx context.Context, execution *models.Execution, generatedTemplate *models.GeneratedTestCode) (*docker.ExecutionResult, error) {
-	if s.dockerExecutor == nil {
+// executionOptions son las opciones de una petición que llegan hasta el executor
+type executionOptions struct {
+	progress docker.ProgressFunc // Eventos de avance (opcional)
+	failFast bool                // Detener la corrida en el primer test fallido
+	compiler docker.CompilerProfile
+
+	testTimeLimitMS int64 // Límite de tiempo por test (0 = el del servicio)
+}
+
+// executeInDocker ejecuta el código en un contenedor Docker con las opciones de la petición
+func (s *solutionEvaluationServiceImpl) executeInDocker(ctx context.Context, execution *models.Execution, generatedTemplate *models.GeneratedTestCode, options executionOptions) (*docker.ExecutionResult, error) {
+	if s.executor == nil {
 		log.Printf("⚠️  Docker executor not available, skipping execution")
 		execution.ExecutionTimeMS = 0
 		execution.Status = models.StatusCompleted
@@ -27,22 +43,55 @@ func (s *solutionEvaluationServiceImpl) executeInDocker(ctx context.Context, exe
 	log.Printf("🐳 Executing code in Docker container...")
 
 	execConfig := docker.DefaultExecutionConfig(execution.ID, generatedTemplate.TestCode)
-
-	dockerCtx, dockerCancel := context.WithTimeout(ctx, time.Duration(execConfig.TimeoutSeconds+5)*time.Second)
+	execConfig.Progress = options.progress
+	execConfig.FailFast = options.failFast
+	execConfig.Compiler = options.compiler.WithDefaults()
+	execConfig.TestTimeLimitMS = options.testTimeLimitMS
+	execConfig.SolutionUnit = generatedTemplate.SolutionUnit
+	execConfig.Declarations = generatedTemplate.Declarations
+	execConfig.TestUnit = generatedTemplate.TestUnit
+
+	// Both phases have their own timeout; allow some extra time for container overhead
+	phaseTimeout := execConfig.CompileTimeoutSeconds + execConfig.TimeoutSeconds
+	dockerCtx, dockerCancel := context.WithTimeout(ctx, time.Duration(phaseTimeout+5)*time.Second)
 	defer dockerCancel()
 
-	dockerResult, err := s.dockerExecutor.Execute(dockerCtx, execConfig)
+	dockerCtx, span := tracing.Start(dockerCtx, "executor.Execute", trace.WithAttributes(
+		attribute.String("coderunner.execution_id", execution.ID.String()),
+		attribute.Int("coderunner.tests", len(execConfig.TestIDs)),
+	))
+	dockerResult, err := s.executor.Execute(dockerCtx, execConfig)
+	if dockerResult != nil {
+		span.SetAttributes(
+			attribute.Bool("coderunner.success", dockerResult.Success),
+			attribute.String("coderunner.error_type", dockerResult.ErrorType),
+		)
+	}
+	tracing.End(span, err)
+
+	// The caller went away (e.g. cancelled after the first failing test): the
+	// container was killed, so this is not a timeout of the solution
+	if ctx.Err() != nil {
+		log.Printf("🛑 Request cancelled during execution: %v", ctx.Err())
+		execution.Status = models.StatusCancelled
+		execution.ErrorMessage = "Request cancelled during execution"
+		s.executionRepo.Update(execution)
+		return nil, status.FromContextError(ctx.Err()).Err()
+	}
+
 	if err != nil {
 		log.Printf("❌ Docker execution error: %v", err)
 		execution.Status = models.StatusFailed
 		execution.ErrorMessage = fmt.Sprintf("Docker execution failed: %v", err)
 		execution.ErrorType = "docker_error"
+		metrics.RecordExecution(execution.ErrorType)
 		s.executionRepo.Update(execution)
 		return nil, fmt.Errorf("failed to execute in Docker: %w", err)
 	}
 
 	log.Printf("✅ Docker execution completed")
-	log.Printf("  ⏱️  Execution time: %d ms", dockerResult.ExecutionTimeMS)
+	log.Printf("  ⏱️  Execution time: %d ms (compile: %d ms, run: %d ms)",
+		dockerResult.ExecutionTimeMS, dockerResult.CompilationTimeMS, dockerResult.RunTimeMS)
 	log.Printf("  📊 Exit code: %d", dockerResult.ExitCode)
 	log.Printf("  🧪 Tests: %d/%d passed", dockerResult.PassedTests, dockerResult.TotalTests)
 
@@ -95,12 +144,17 @@ func (s *solutionEvaluationServiceImpl) processResults(execution *models.Executi
 		// Use error type from dockerResult (compilation_error, runtime_error, etc.)
 		execution.ErrorType = dockerResult.ErrorType
 		execution.ErrorMessage = dockerResult.ErrorMessage
+		if !dockerResult.Compiled {
+			execution.CompilationError = dockerResult.CompilationLog
+		}
 
 		// Set appropriate message based on error type
 		if dockerResult.ErrorType == "compilation_error" {
 			execution.Message = "Compilation failed"
 		} else if dockerResult.ErrorType == "runtime_error" {
 			execution.Message = "Runtime error occurred"
+		} else if dockerResult.ErrorType == "output_limit_exceeded" {
+			execution.Message = "Output limit exceeded"
 		} else {
 			execution.Message = fmt.Sprintf("Execution failed: %d/%d tests passed", dockerResult.PassedTests, dockerResult.TotalTests)
 		}
@@ -109,13 +163,8 @@ func (s *solutionEvaluationServiceImpl) processResults(execution *models.Executi
 	execution.SetApprovedTestIDs(approvedIDs)
 	execution.SetFailedTestIDs(failedIDs)
 
-	// Log output for debugging
-	if len(dockerResult.StdOut) > 0 {
-		log.Printf("  📤 Stdout:\n%s", dockerResult.StdOut)
-	}
-	if len(dockerResult.StdErr) > 0 {
-		log.Printf("  📤 Stderr:\n%s", dockerResult.StdErr)
-	}
+	// The executor already logged a preview of the output
+	log.Printf("  📤 Output: %d bytes stdout, %d bytes stderr", len(dockerResult.StdOut), len(dockerResult.StdErr))
 
 	return execution
 }
@@ -145,7 +194,7 @@ func (s *solutionEvaluationServiceImpl) extractTestIDs(dockerResult *docker.Exec
 }
 
 // publishMetricsToKafka publica las métricas de ejecución a Kafka
-func (s *solutionEvaluationServiceImpl) publishMetricsToKafka(ctx context.Context, execution *models.Execution, dockerResult *docker.ExecutionResult, executionTimeMS int64) {
+func (s *solutionEvaluationServiceImpl) publishMetricsToKafka(ctx context.Context, execution *models.Execution, dockerResult *docker.ExecutionResult, executionTimeMS, queueWaitMS int64) {
 	// Si no hay cliente de Kafka, no hacer nada
 	if s.kafkaClient == nil {
 		log.Printf("⚠️  Kafka client not available, skipping metrics publishing")
@@ -164,6 +213,7 @@ func (s *solutionEvaluationServiceImpl) publishMetricsToKafka(ctx context.Contex
 
 		// Métricas de rendimiento
 		ExecutionTimeMS: executionTimeMS,
+		QueueWaitMS:     queueWaitMS,
 		TotalTests:      execution.TotalTests,
 		PassedTests:     execution.PassedTests,
 		FailedTests:     execution.TotalTests - execution.PassedTests,
@@ -180,8 +230,19 @@ func (s *solutionEvaluationServiceImpl) publishMetricsToKafka(ctx context.Contex
 	// Agregar métricas de Docker si están disponibles
 	if dockerResult != nil {
 		event.MemoryUsageMB = dockerResult.MemoryUsageMB
+		event.CPUUserMS = dockerResult.CPUUserMS
+		event.CPUSystemMS = dockerResult.CPUSystemMS
+		event.WallTimeMS = dockerResult.WallTimeMS
 		event.ExitCode = dockerResult.ExitCode
 
+		// Compilation phase
+		event.CompilationSuccess = dockerResult.Compiled
+		event.CompilationTimeMS = dockerResult.CompilationTimeMS
+		if !event.CompilationSuccess {
+			event.CompilationError = dockerResult.ErrorMessage
+		}
+		event.CompilationWarnings = strings.Count(dockerResult.CompilationLog, "warning:")
+
 		// Agregar resultados de tests individuales
 		if len(dockerResult.TestResults) > 0 {
 			event.TestResults = make([]kafka.TestResultMetric, 0, len(dockerResult.TestResults))
@@ -191,18 +252,26 @@ func (s *solutionEvaluationServiceImpl) publishMetricsToKafka(ctx context.Contex
 					TestName:        testResult.TestName,
 					Passed:          testResult.Passed,
 					ExecutionTimeMS: testResult.ExecutionTimeMS,
+					DurationNS:      testResult.DurationNS,
+					Allocations:     testResult.Allocations,
+					PeakMemoryKB:    testResult.PeakMemoryKB,
 					ErrorMessage:    testResult.ErrorMessage,
+					ErrorType:       testResult.ErrorType,
 				})
 			}
 		}
 	}
 
-	// Publicar a Kafka de forma asíncrona
+	// Publicar a Kafka de forma asíncrona; el contexto conserva la traza de la petición
+	// pero no su cancelación
 	go func() {
-		publishCtx, cancel := context.WithTimeout(context.Background(), 5*time.Second)
+		publishCtx, cancel := context.WithTimeout(context.WithoutCancel(ctx), 5*time.Second)
 		defer cancel()
 
-		if err := s.kafkaClient.PublishExecutionMetrics(publishCtx, event); err != nil {
+		publishStart := time.Now()
+		err := s.kafkaClient.PublishExecutionMetrics(publishCtx, event)
+		metrics.ObserveStage(metrics.StageKafkaPublish, publishStart)
+		if err != nil {
 			log.Printf("⚠️  Failed to publish metrics to Kafka: %v", err)
 		} else {
 			log.Printf("✅ Metrics published to Kafka for execution %s", execution.ID)
@@ -8,10 +8,14 @@ import (
 	"time"
 
 	"github.com/google/uuid"
+	"go.opentelemetry.io/otel/attribute"
+	"go.opentelemetry.io/otel/trace"
 
 	pb "code-runner/api/gen/proto"
 	"code-runner/internal/database/models"
 	"code-runner/internal/docker"
+	"code-runner/internal/metrics"
+	"code-runner/internal/tracing"
 	"code-runner/internal/types"
 )
 
@@ -33,34 +37,70 @@ func (s *solutionEvaluationServiceImpl) EvaluateSolution(ctx context.Context, re
 	startTime := time.Now()
 
 	// Parse and validate UUIDs
-	internalReq, err := s.parseAndValidateRequest(req)
+	internalReq, err := s.parseAndValidateRequest(ctx, req)
 	if err != nil {
 		return nil, err
 	}
 
-	// Create execution record
-	execution, err := s.createExecutionRecord(internalReq)
+	// Admission control: reject early when the execution queue is full
+	ticket, err := s.scheduler.admit()
 	if err != nil {
 		return nil, err
 	}
+	defer ticket.release()
 
-	// Generate template
-	generatedTemplate, err := s.generateTemplate(internalReq, execution)
+	return s.evaluateAdmitted(ctx, req, internalReq, ticket, nil, startTime)
+}
+
+// evaluateAdmitted ejecuta una petición ya validada y admitida por el scheduler:
+// registro en base de datos, template, ejecución, métricas y respuesta. progress
+// (opcional) recibe los eventos de avance del executor.
+func (s *solutionEvaluationServiceImpl) evaluateAdmitted(ctx context.Context, req *pb.ExecutionRequest, internalReq *types.ExecutionRequest, ticket *executionTicket, progress docker.ProgressFunc, startTime time.Time) (*pb.ExecutionResponse, error) {
+	execution, dockerResult, err := s.executeAdmitted(ctx, internalReq, ticket, progress)
 	if err != nil {
 		return nil, err
 	}
+	return s.completeExecution(ctx, req, internalReq, execution, dockerResult, ticket.queueWait, startTime)
+}
 
-	// Execute in Docker
-	dockerResult, err := s.executeInDocker(ctx, execution, generatedTemplate)
+// executeAdmitted crea el registro de ejecución, genera el template y lo ejecuta
+// (o reutiliza un resultado memorizado para un template idéntico)
+func (s *solutionEvaluationServiceImpl) executeAdmitted(ctx context.Context, internalReq *types.ExecutionRequest, ticket *executionTicket, progress docker.ProgressFunc) (*models.Execution, *docker.ExecutionResult, error) {
+	// Create execution record
+	execution, err := s.createExecutionRecord(ctx, internalReq)
 	if err != nil {
-		return nil, err
+		return nil, nil, err
 	}
 
+	// Generate template
+	generatedTemplate, err := s.generateTemplate(ctx, internalReq, execution)
+	if err != nil {
+		return nil, nil, err
+	}
+
+	// Execute in Docker (or reuse a memoized result for an identical template)
+	dockerResult, err := s.executeWithResultCache(ctx, execution, generatedTemplate, ticket, executionOptions{progress: progress, failFast: internalReq.FailFast, compiler: internalReq.Compiler, testTimeLimitMS: internalReq.TestTimeLimitMS})
+	if err != nil {
+		return nil, nil, err
+	}
+	return execution, dockerResult, nil
+}
+
+// completeExecution registra el resultado de una ejecución: actualiza el registro,
+// publica las métricas en Kafka y construye la respuesta
+func (s *solutionEvaluationServiceImpl) completeExecution(ctx context.Context, req *pb.ExecutionRequest, internalReq *types.ExecutionRequest, execution *models.Execution, dockerResult *docker.ExecutionResult, queueWait time.Duration, startTime time.Time) (*pb.ExecutionResponse, error) {
 	// Process results
 	execution = s.processResults(execution, dockerResult, internalReq)
 
+	metrics.RecordExecution(execution.ErrorType)
+
 	// Update execution record
-	if err := s.executionRepo.Update(execution); err != nil {
+	_, span := tracing.Start(ctx, "executionRepo.Update")
+	updateStart := time.Now()
+	err := s.executionRepo.Update(execution)
+	metrics.ObserveStage(metrics.StageDBUpdate, updateStart)
+	tracing.End(span, err)
+	if err != nil {
 		log.Printf("❌ Error updating execution record: %v", err)
 		return nil, fmt.Errorf("failed to update execution record: %w", err)
 	}
@@ -69,7 +109,7 @@ func (s *solutionEvaluationServiceImpl) EvaluateSolution(ctx context.Context, re
 	executionTime := time.Since(startTime)
 
 	// Publish metrics to Kafka
-	s.publishMetricsToKafka(ctx, execution, dockerResult, executionTime.Milliseconds())
+	s.publishMetricsToKafka(ctx, execution, dockerResult, executionTime.Milliseconds(), queueWait.Milliseconds())
 
 	// Build response
 	return s.buildResponse(req, execution, dockerResult, startTime)
@@ -102,7 +142,10 @@ func (s *solutionEvaluationServiceImpl) logTestCases(tests []*pb.TestCase) {
 }
 
 // parseAndValidateRequest valida y parsea el request
-func (s *solutionEvaluationServiceImpl) parseAndValidateRequest(req *pb.ExecutionRequest) (*types.ExecutionRequest, error) {
+func (s *solutionEvaluationServiceImpl) parseAndValidateRequest(ctx context.Context, req *pb.ExecutionRequest) (internalReq *types.ExecutionRequest, err error) {
+	_, span := tracing.Start(ctx, "parseAndValidateRequest", trace.WithAttributes(attribute.Int("coderunner.tests", len(req.Tests))))
+	defer func() { tracing.End(span, err) }()
+
 	// Helper function to parse UUID
 	parseUUID := func(id string, fieldName string) (uuid.UUID, error) {
 		// If ID is empty, return error
@@ -137,7 +180,18 @@ func (s *solutionEvaluationServiceImpl) parseAndValidateRequest(req *pb.Executio
 	// Use default language (C++) for now
 	language := "cpp"
 
-	internalReq := &types.ExecutionRequest{
+	compiler := convertCompilerProfile(req.CompilerProfile)
+	if err := compiler.Validate(); err != nil {
+		return nil, err
+	}
+
+	// The per-test limit has to fit in the run timeout to mean anything
+	runTimeoutMS := docker.DefaultDockerConfig().DefaultTimeout.Milliseconds()
+	if req.TestTimeLimitMs < 0 || int64(req.TestTimeLimitMs) > runTimeoutMS {
+		return nil, fmt.Errorf("test_time_limit_ms must be between 0 and %d", runTimeoutMS)
+	}
+
+	internalReq = &types.ExecutionRequest{
 		SolutionID:    challengeID,
 		ChallengeID:   challengeID,
 		CodeVersionID: codeVersionID,
@@ -145,6 +199,10 @@ func (s *solutionEvaluationServiceImpl) parseAndValidateRequest(req *pb.Executio
 		Code:          req.Code,
 		Language:      language,
 		TestCases:     convertTestCases(req.Tests),
+		FailFast:      req.FailFast,
+		Compiler:      compiler,
+
+		TestTimeLimitMS: int64(req.TestTimeLimitMs),
 	}
 
 	log.Printf("🔧 Converting to internal types...")
@@ -156,7 +214,7 @@ func (s *solutionEvaluationServiceImpl) parseAndValidateRequest(req *pb.Executio
 }
 
 // createExecutionRecord crea un registro de ejecución en la base de datos
-func (s *solutionEvaluationServiceImpl) createExecutionRecord(req *types.ExecutionRequest) (*models.Execution, error) {
+func (s *solutionEvaluationServiceImpl) createExecutionRecord(ctx context.Context, req *types.ExecutionRequest) (*models.Execution, error) {
 	log.Printf("📝 Creating execution record...")
 	execution := &models.Execution{
 		SolutionID:  req.SolutionID.String(),
@@ -168,7 +226,12 @@ func (s *solutionEvaluationServiceImpl) createExecutionRecord(req *types.Executi
 		TotalTests:  len(req.TestCases),
 	}
 
-	if err := s.executionRepo.Create(execution); err != nil {
+	_, span := tracing.Start(ctx, "createExecutionRecord")
+	insertStart := time.Now()
+	err := s.executionRepo.Create(execution)
+	metrics.ObserveStage(metrics.StageDBInsert, insertStart)
+	tracing.End(span, err)
+	if err != nil {
 		log.Printf("❌ Error creating execution record: %v", err)
 		return nil, fmt.Errorf("failed to create execution record: %w", err)
 	}
@@ -178,9 +241,13 @@ func (s *solutionEvaluationServiceImpl) createExecutionRecord(req *types.Executi
 }
 
 // generateTemplate genera el template de código C++
-func (s *solutionEvaluationServiceImpl) generateTemplate(req *types.ExecutionRequest, execution *models.Execution) (*models.GeneratedTestCode, error) {
+func (s *solutionEvaluationServiceImpl) generateTemplate(ctx context.Context, req *types.ExecutionRequest, execution *models.Execution) (*models.GeneratedTestCode, error) {
 	log.Printf("🔧 Generating C++ execution template...")
+	_, span := tracing.Start(ctx, "generateTemplate")
+	generationStart := time.Now()
 	generatedTemplate, err := s.templateGenerator.GenerateTemplate(req, execution.ID)
+	metrics.ObserveStage(metrics.StageTemplateGeneration, generationStart)
+	tracing.End(span, err)
 	if err != nil {
 		log.Printf("❌ Error generating template: %v", err)
 		execution.Status = models.StatusFailed
@@ -11,6 +11,7 @@ import (
 	"github.com/google/uuid"
 
 	pb "code-runner/api/gen/proto"
+	"code-runner/internal/docker"
 	"code-runner/internal/types"
 )
 
@@ -128,3 +129,15 @@ func convertTestCases(protoTests []*pb.TestCase) []*types.TestCase {
 	}
 	return tests
 }
+
+// convertCompilerProfile convierte el perfil de compilación del proto, completando los
+// campos vacíos con los valores por defecto (sin validarlo)
+func convertCompilerProfile(profile *pb.CompilerProfile) docker.CompilerProfile {
+	return docker.CompilerProfile{
+		Compiler:     profile.GetCompiler(),
+		Standard:     profile.GetStandard(),
+		Optimization: profile.GetOptimization(),
+		March:        profile.GetMarch(),
+		Sanitizers:   profile.GetSanitizers(),
+	}.WithDefaults()
+}
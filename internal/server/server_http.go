@@ -0,0 +1,33 @@
+package server
+
+import (
+	"log"
+	"net/http"
+	"time"
+
+	"code-runner/internal/metrics"
+)
+
+// NewHTTPHandler retorna los endpoints HTTP del servicio: /health (healthcheck del
+// contenedor) y /metrics (métricas en formato Prometheus)
+func NewHTTPHandler() http.Handler {
+	mux := http.NewServeMux()
+	mux.HandleFunc("/health", func(w http.ResponseWriter, req *http.Request) {
+		w.Header().Set("Content-Type", "application/json")
+		w.Write([]byte(`{"status":"UP"}`))
+	})
+	mux.Handle("/metrics", metrics.Handler())
+	return mux
+}
+
+// StartHTTPServer sirve NewHTTPHandler en el puerto dado; bloquea hasta que el servidor falla
+func StartHTTPServer(port string) error {
+	httpServer := &http.Server{
+		Addr:              ":" + port,
+		Handler:           NewHTTPHandler(),
+		ReadHeaderTimeout: 5 * time.Second,
+	}
+
+	log.Printf("📈 Starting HTTP server on port %s (/health, /metrics)", port)
+	return httpServer.ListenAndServe()
+}
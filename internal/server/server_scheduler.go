@@ -0,0 +1,142 @@
+package server
+
+import (
+	"context"
+	"log"
+	"time"
+
+	"google.golang.org/grpc/codes"
+	"google.golang.org/grpc/status"
+
+	"code-runner/internal/database/models"
+	"code-runner/internal/docker"
+	"code-runner/internal/metrics"
+	"code-runner/internal/tracing"
+)
+
+// executionScheduler limita cuántas ejecuciones corren a la vez (slots) y cuántas
+// pueden esperar turno (cola). Las peticiones que no caben en la cola se rechazan
+// con RESOURCE_EXHAUSTED en lugar de lanzar más contenedores de los que el host soporta.
+type executionScheduler struct {
+	slots    chan struct{} // una entrada por ejecución en curso
+	admitted chan struct{} // una entrada por petición admitida (en curso + en cola)
+}
+
+// executionTicket representa una petición admitida por el scheduler
+type executionTicket struct {
+	scheduler *executionScheduler
+	running   bool
+	released  bool
+	queueWait time.Duration // tiempo esperado en cola hasta obtener un slot
+}
+
+// newExecutionScheduler crea un scheduler con el número de slots y tamaño de cola dados
+func newExecutionScheduler(slots, queueSize int) *executionScheduler {
+	if slots < 1 {
+		slots = 1
+	}
+	if queueSize < 0 {
+		queueSize = 0
+	}
+	return &executionScheduler{
+		slots:    make(chan struct{}, slots),
+		admitted: make(chan struct{}, slots+queueSize),
+	}
+}
+
+// admit reserva un lugar en la cola sin bloquear; retorna RESOURCE_EXHAUSTED si está llena
+func (s *executionScheduler) admit() (*executionTicket, error) {
+	select {
+	case s.admitted <- struct{}{}:
+		metrics.ExecutionsInFlight.WithLabelValues("queued").Inc()
+		return &executionTicket{scheduler: s}, nil
+	default:
+		log.Printf("🚫 Execution queue full (%d running, %d admitted), rejecting request", len(s.slots), len(s.admitted))
+		return nil, status.Errorf(codes.ResourceExhausted,
+			"code runner is at capacity (%d executions running or queued), retry later", cap(s.admitted))
+	}
+}
+
+// admitWait reserva un lugar en la cola esperando a que haya espacio, para trabajos en
+// lote que no deben rechazarse. Solo debe usarse con pocas peticiones a la vez para no
+// ocupar la cola que necesitan las peticiones interactivas.
+func (s *executionScheduler) admitWait(ctx context.Context) (*executionTicket, error) {
+	select {
+	case s.admitted <- struct{}{}:
+		metrics.ExecutionsInFlight.WithLabelValues("queued").Inc()
+		return &executionTicket{scheduler: s}, nil
+	case <-ctx.Done():
+		return nil, status.FromContextError(ctx.Err()).Err()
+	}
+}
+
+// wait bloquea hasta obtener un slot de ejecución, registrando el tiempo esperado en cola
+func (t *executionTicket) wait(ctx context.Context) error {
+	if t.running {
+		return nil
+	}
+
+	start := time.Now()
+	defer func() { t.queueWait = time.Since(start) }()
+
+	select {
+	case t.scheduler.slots <- struct{}{}:
+		t.running = true
+		metrics.ExecutionsInFlight.WithLabelValues("queued").Dec()
+		metrics.ExecutionsInFlight.WithLabelValues("running").Inc()
+		return nil
+	case <-ctx.Done():
+		return status.FromContextError(ctx.Err()).Err()
+	}
+}
+
+// release libera el slot (si se obtuvo) y el lugar en la cola
+func (t *executionTicket) release() {
+	if t.released {
+		return
+	}
+	t.released = true
+	if t.running {
+		<-t.scheduler.slots
+		metrics.ExecutionsInFlight.WithLabelValues("running").Dec()
+	} else {
+		metrics.ExecutionsInFlight.WithLabelValues("queued").Dec()
+	}
+	<-t.scheduler.admitted
+}
+
+// stats retorna las ejecuciones en curso y las que esperan en cola
+func (s *executionScheduler) stats() (running, queued int) {
+	running = len(s.slots)
+	queued = len(s.admitted) - running
+	if queued < 0 {
+		queued = 0
+	}
+	return running, queued
+}
+
+// runWhenScheduled espera un slot de ejecución y ejecuta el template en Docker, liberando
+// el slot al terminar. Si la petición se cancela mientras espera, la ejecución queda
+// registrada como cancelada.
+func (s *solutionEvaluationServiceImpl) runWhenScheduled(ctx context.Context, execution *models.Execution, generatedTemplate *models.GeneratedTestCode, ticket *executionTicket, options executionOptions) (*docker.ExecutionResult, error) {
+	defer ticket.release()
+
+	_, span := tracing.Start(ctx, "queueWait")
+	err := ticket.wait(ctx)
+	tracing.End(span, err)
+	if err != nil {
+		log.Printf("❌ Request cancelled while waiting for an execution slot: %v", err)
+		execution.Status = models.StatusCancelled
+		execution.ErrorMessage = "Request cancelled while waiting in the execution queue"
+		s.executionRepo.Update(execution)
+		return nil, err
+	}
+
+	metrics.StageDuration.WithLabelValues(metrics.StageQueueWait).Observe(ticket.queueWait.Seconds())
+	if ticket.queueWait >= time.Millisecond {
+		running, queued := s.scheduler.stats()
+		log.Printf("⏳ Waited %d ms for an execution slot (%d running, %d queued)", ticket.queueWait.Milliseconds(), running, queued)
+	}
+
+	return s.executeInDocker(ctx, execution, generatedTemplate, options)
+}
@@ -0,0 +1,96 @@
+package server
+
+import (
+	"context"
+	"testing"
+	"time"
+
+	"google.golang.org/grpc/codes"
+	"google.golang.org/grpc/status"
+)
+
+func TestExecutionScheduler_RejectsWhenQueueIsFull(t *testing.T) {
+	scheduler := newExecutionScheduler(1, 1)
+
+	running, err := scheduler.admit()
+	if err != nil {
+		t.Fatalf("Expected first request to be admitted, got: %v", err)
+	}
+	if err := running.wait(context.Background()); err != nil {
+		t.Fatalf("Expected first request to get a slot, got: %v", err)
+	}
+
+	queued, err := scheduler.admit()
+	if err != nil {
+		t.Fatalf("Expected second request to be queued, got: %v", err)
+	}
+
+	if _, err := scheduler.admit(); status.Code(err) != codes.ResourceExhausted {
+		t.Fatalf("Expected RESOURCE_EXHAUSTED for third request, got: %v", err)
+	}
+
+	// Releasing the running request lets the queued one through
+	go func() {
+		time.Sleep(10 * time.Millisecond)
+		running.release()
+	}()
+	if err := queued.wait(context.Background()); err != nil {
+		t.Fatalf("Expected queued request to get a slot, got: %v", err)
+	}
+	if queued.queueWait < 10*time.Millisecond {
+		t.Errorf("Expected queue wait to be recorded, got %s", queued.queueWait)
+	}
+	queued.release()
+
+	if r, q := scheduler.stats(); r != 0 || q != 0 {
+		t.Errorf("Expected empty scheduler, got %d running and %d queued", r, q)
+	}
+}
+
+func TestExecutionScheduler_WaitHonorsContext(t *testing.T) {
+	scheduler := newExecutionScheduler(1, 1)
+
+	running, _ := scheduler.admit()
+	running.wait(context.Background())
+	defer running.release()
+
+	queued, err := scheduler.admit()
+	if err != nil {
+		t.Fatalf("Expected request to be queued, got: %v", err)
+	}
+
+	ctx, cancel := context.WithTimeout(context.Background(), 10*time.Millisecond)
+	defer cancel()
+
+	if err := queued.wait(ctx); status.Code(err) != codes.DeadlineExceeded {
+		t.Errorf("Expected DEADLINE_EXCEEDED, got: %v", err)
+	}
+	queued.release()
+
+	// The cancelled request must free its place in the queue
+	if _, err := scheduler.admit(); err != nil {
+		t.Errorf("Expected queue space after cancellation, got: %v", err)
+	}
+}
+
+func TestExecutionScheduler_AdmitWaitBlocksUntilQueueSpace(t *testing.T) {
+	scheduler := newExecutionScheduler(1, 0)
+
+	running, _ := scheduler.admit()
+
+	go func() {
+		time.Sleep(10 * time.Millisecond)
+		running.release()
+	}()
+	ticket, err := scheduler.admitWait(context.Background())
+	if err != nil {
+		t.Fatalf("Expected batch request to be admitted once space frees up, got: %v", err)
+	}
+	defer ticket.release()
+
+	ctx, cancel := context.WithTimeout(context.Background(), 10*time.Millisecond)
+	defer cancel()
+	if _, err := scheduler.admitWait(ctx); status.Code(err) != codes.DeadlineExceeded {
+		t.Errorf("Expected DEADLINE_EXCEEDED while the queue is full, got: %v", err)
+	}
+}
@@ -0,0 +1,179 @@
+package server
+
+import (
+	"fmt"
+	"log"
+	"sync"
+	"time"
+
+	pb "code-runner/api/gen/proto"
+	"code-runner/internal/docker"
+)
+
+// Fases que agrega el servidor a las del executor (ver docker.ProgressEvent)
+const (
+	progressPhaseQueued = "queued"
+	progressPhaseDone   = "done"
+)
+
+// progressBufferSize es cuántos eventos pueden esperar a un cliente lento antes de que
+// los del executor empiecen a descartarse
+const progressBufferSize = 256
+
+// progressStream envía los eventos de avance al stream gRPC desde su propia goroutine.
+// El executor los emite mientras copia el stdout de la solución, así que emit nunca
+// espera a la red: con la cola llena el evento se descarta, en lugar de frenar la copia
+// y con ella a la solución (que se bloquearía con el pipe lleno y podría superar su
+// timeout). La respuesta final siempre llega en el evento done.
+type progressStream struct {
+	stream    pb.SolutionEvaluationService_EvaluateSolutionStreamServer
+	startTime time.Time
+	events    chan *pb.ExecutionProgress
+	sent      chan struct{} // se cierra cuando la goroutine de envío termina
+
+	mu      sync.Mutex
+	closed  bool
+	dropped int   // eventos del executor descartados con la cola llena
+	err     error // primer error de Send (el cliente se fue)
+}
+
+// newProgressStream crea el stream de avance y arranca su goroutine de envío
+func newProgressStream(stream pb.SolutionEvaluationService_EvaluateSolutionStreamServer, startTime time.Time) *progressStream {
+	p := &progressStream{
+		stream:    stream,
+		startTime: startTime,
+		events:    make(chan *pb.ExecutionProgress, progressBufferSize),
+		sent:      make(chan struct{}),
+	}
+	go p.run()
+	return p
+}
+
+// run envía los eventos en orden; tras un error de Send solo drena la cola
+func (p *progressStream) run() {
+	defer close(p.sent)
+	for event := range p.events {
+		p.mu.Lock()
+		failed := p.err != nil
+		p.mu.Unlock()
+		if failed {
+			continue
+		}
+
+		if err := p.stream.Send(event); err != nil {
+			p.mu.Lock()
+			p.err = err
+			p.mu.Unlock()
+		}
+	}
+}
+
+// send encola un evento del handler (queued, done), esperando lugar si la cola está
+// llena. Solo el handler lo llama, y nunca después de close.
+func (p *progressStream) send(event *pb.ExecutionProgress) error {
+	p.mu.Lock()
+	if p.closed || p.err != nil {
+		defer p.mu.Unlock()
+		return p.err
+	}
+	event.ElapsedMs = time.Since(p.startTime).Milliseconds()
+	p.mu.Unlock()
+
+	p.events <- event
+	return nil
+}
+
+// emit adapta un evento del executor al mensaje del proto y lo encola sin bloquear
+func (p *progressStream) emit(event docker.ProgressEvent) {
+	p.mu.Lock()
+	defer p.mu.Unlock()
+	if p.closed || p.err != nil {
+		return
+	}
+
+	select {
+	case p.events <- &pb.ExecutionProgress{
+		Phase:          event.Phase,
+		TestId:         event.TestID,
+		Passed:         event.Passed,
+		TestDurationMs: event.DurationNS / int64(time.Millisecond),
+		Message:        event.Message,
+		ElapsedMs:      time.Since(p.startTime).Milliseconds(),
+	}:
+	default:
+		if p.dropped == 0 {
+			log.Printf("  ⚠️  Progress stream client is slow, dropping progress events")
+		}
+		p.dropped++
+	}
+}
+
+// close impide nuevos eventos, espera a que se envíen los encolados y retorna el primer
+// error de Send. El stream no puede usarse después de que el handler retorna.
+func (p *progressStream) close() error {
+	p.mu.Lock()
+	if !p.closed {
+		p.closed = true
+		close(p.events)
+	}
+	p.mu.Unlock()
+
+	<-p.sent
+
+	p.mu.Lock()
+	defer p.mu.Unlock()
+	if p.dropped > 0 {
+		log.Printf("  📡 %d progress events dropped", p.dropped)
+		p.dropped = 0
+	}
+	return p.err
+}
+
+// EvaluateSolutionStream evalúa una solución como EvaluateSolution pero informa el avance
+// mientras ocurre: queued, compiling, compiled, running, un evento test por cada test a
+// medida que termina y done con la respuesta final. Si el cliente cancela la llamada (por
+// ejemplo, tras el primer test fallido) la ejecución se detiene y libera su slot.
+func (s *solutionEvaluationServiceImpl) EvaluateSolutionStream(req *pb.ExecutionRequest, stream pb.SolutionEvaluationService_EvaluateSolutionStreamServer) error {
+	ctx := stream.Context()
+	log.Printf("📡 ===== RECEIVED STREAMING EXECUTION REQUEST =====")
+	log.Printf("  👤 Student ID: '%s'", req.StudentId)
+	log.Printf("  💻 Code length: %d characters", len(req.Code))
+	log.Printf("  🧪 Test cases: %d", len(req.Tests))
+
+	startTime := time.Now()
+
+	internalReq, err := s.parseAndValidateRequest(ctx, req)
+	if err != nil {
+		return err
+	}
+
+	ticket, err := s.scheduler.admit()
+	if err != nil {
+		return err
+	}
+	defer ticket.release()
+
+	progress := newProgressStream(stream, startTime)
+	defer progress.close()
+
+	running, queued := s.scheduler.stats()
+	if err := progress.send(&pb.ExecutionProgress{
+		Phase:   progressPhaseQueued,
+		Message: fmt.Sprintf("%d running, %d queued", running, queued),
+	}); err != nil {
+		return err
+	}
+
+	response, err := s.evaluateAdmitted(ctx, req, internalReq, ticket, progress.emit, startTime)
+	if err != nil {
+		return err
+	}
+
+	if err := progress.send(&pb.ExecutionProgress{
+		Phase:    progressPhaseDone,
+		Response: response,
+	}); err != nil {
+		return err
+	}
+	return progress.close()
+}
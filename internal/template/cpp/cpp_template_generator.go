@@ -58,6 +58,14 @@ func (g *CppTemplateGenerator) GenerateTemplate(req *types.ExecutionRequest, exe
 		CodeSizeBytes:       len(template),
 	}
 
+	// Emit the solution and the tests as separate translation units when the tests only
+	// need the tested function's prototype, so unchanged tests are not recompiled
+	if solutionUnit, declarations, testUnit, ok := g.splitUnits(req, testCode); ok {
+		record.SolutionUnit = solutionUnit
+		record.Declarations = declarations
+		record.TestUnit = testUnit
+	}
+
 	// Save to database
 	if err := g.repo.Create(record); err != nil {
 		return nil, fmt.Errorf("error saving template to database: %w", err)
@@ -65,3 +73,20 @@ func (g *CppTemplateGenerator) GenerateTemplate(req *types.ExecutionRequest, exe
 
 	return record, nil
 }
+
+// splitUnits builds the solution unit, the declarations header and the test unit of the
+// split compilation, or reports false when the solution needs the single template
+func (g *CppTemplateGenerator) splitUnits(req *types.ExecutionRequest, testCode string) (string, string, string, bool) {
+	if !g.templateBuilder.SupportsSplitCompilation(req.Code, req.TestCases) {
+		return "", "", "", false
+	}
+	prototype, err := g.functionParser.ExtractFunctionPrototype(req.Code)
+	if err != nil {
+		return "", "", "", false
+	}
+
+	return g.templateBuilder.BuildSolutionUnit(req.Code),
+		g.templateBuilder.BuildDeclarations(req.Code, prototype),
+		g.templateBuilder.BuildTestUnit(testCode),
+		true
+}
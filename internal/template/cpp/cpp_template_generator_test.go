@@ -0,0 +1,74 @@
+package template
+
+import (
+	"os"
+	"os/exec"
+	"path/filepath"
+	"testing"
+
+	"code-runner/internal/types"
+)
+
+// TestCppTemplateGenerator_SplitUnitsCompile builds the split units of a few solutions and
+// compiles, links and runs them with g++, against the doctest.h in the compiler's include
+// path (as in the coderunner-cpp image; CPLUS_INCLUDE_PATH works too). It is skipped when
+// either is missing.
+func TestCppTemplateGenerator_SplitUnitsCompile(t *testing.T) {
+	compiler, err := exec.LookPath("g++")
+	if err != nil {
+		t.Skip("g++ not available")
+	}
+	dir := t.TempDir()
+	mainFile := filepath.Join(dir, "main.cpp")
+	if err := os.WriteFile(mainFile, []byte("#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN\n#include \"doctest.h\"\n"), 0644); err != nil {
+		t.Fatal(err)
+	}
+	if output, err := exec.Command(compiler, "-std=c++17", "-c", mainFile, "-o", filepath.Join(dir, "main.o")).CombinedOutput(); err != nil {
+		t.Skipf("doctest.h not available: %s", output)
+	}
+
+	generator := NewCppTemplateGenerator(nil)
+	cases := []struct {
+		name     string
+		code     string
+		input    string
+		expected string
+	}{
+		{"strlen without its include", "int length(const char* s) {\n    return strlen(s);\n}\n", "hello", "5"},
+		{"using-declaration", "#include <string>\nusing std::string;\n\nint count(string s) {\n    return s.size();\n}\n", "hello", "5"},
+		{"using-directive and array", "#include <vector>\nusing namespace std;\n\nint sum(int* nums, int n) {\n    vector<int> v(nums, nums + n);\n    int total = 0;\n    for (int x : v) total += x;\n    return total;\n}\n", "[1,2,3]", "6"},
+	}
+	for _, tc := range cases {
+		req := &types.ExecutionRequest{
+			Code:      tc.code,
+			TestCases: []*types.TestCase{{Input: tc.input, ExpectedOutput: tc.expected}},
+		}
+		functionName, returnType, err := generator.functionParser.ExtractFunctionInfo(req.Code)
+		if err != nil {
+			t.Fatalf("%s: %v", tc.name, err)
+		}
+		testCode, _ := generator.testGenerator.GenerateTestCode(req.TestCases, functionName, returnType)
+		solutionUnit, declarations, testUnit, ok := generator.splitUnits(req, testCode)
+		if !ok {
+			t.Fatalf("%s: expected split units", tc.name)
+		}
+
+		caseDir := t.TempDir()
+		files := map[string]string{"solution.cpp": solutionUnit, "solution.h": declarations, "tests.cpp": testUnit}
+		for name, content := range files {
+			if err := os.WriteFile(filepath.Join(caseDir, name), []byte(content), 0644); err != nil {
+				t.Fatal(err)
+			}
+		}
+		binary := filepath.Join(caseDir, "solution")
+		build := exec.Command(compiler, "-std=c++17", "solution.cpp", "tests.cpp", filepath.Join(dir, "main.o"), "-o", binary)
+		build.Dir = caseDir
+		if output, err := build.CombinedOutput(); err != nil {
+			t.Errorf("%s: compilation failed: %v\n%s", tc.name, err, output)
+			continue
+		}
+		if output, err := exec.Command(binary).CombinedOutput(); err != nil {
+			t.Errorf("%s: tests failed: %v\n%s", tc.name, err, output)
+		}
+	}
+}
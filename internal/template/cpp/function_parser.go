@@ -6,6 +6,12 @@ import (
 	"strings"
 )
 
+// functionPattern matches a function definition at the start of a line.
+// Group 1: complete return type
+// Group 2: function name
+// Group 3: parameter list
+var functionPattern = regexp.MustCompile(`(?m)^\s*((?:const\s+)?(?:unsigned\s+)?(?:int|void|double|float|char|string|bool|auto|long|short|size_t|int8_t|int16_t|int32_t|int64_t|uint8_t|uint16_t|uint32_t|uint64_t|vector<[^>]+>|std::string|std::vector<[^>]+>)(?:\s*\*|\s*&)?)\s+(\w+)\s*\(([^)]*)\)\s*\{`)
+
 // FunctionParser handles extraction of function information from C++ code
 type FunctionParser struct{}
 
@@ -22,10 +28,7 @@ func (p *FunctionParser) ExtractFunctionInfo(code string) (string, string, error
 	//   - stdint types: int64_t, uint32_t, size_t, etc.
 	//   - STL types: vector<T>, std::string, etc.
 	//   - Modifiers: const, unsigned, *, &
-	// Group 1: complete type
-	// Group 2: function name
-	re := regexp.MustCompile(`(?m)^\s*((?:const\s+)?(?:unsigned\s+)?(?:int|void|double|float|char|string|bool|auto|long|short|size_t|int8_t|int16_t|int32_t|int64_t|uint8_t|uint16_t|uint32_t|uint64_t|vector<[^>]+>|std::string|std::vector<[^>]+>)(?:\s*\*|\s*&)?)\s+(\w+)\s*\([^)]*\)\s*\{`)
-	matches := re.FindStringSubmatch(code)
+	matches := functionPattern.FindStringSubmatch(code)
 
 	if len(matches) < 3 {
 		return "", "", fmt.Errorf("no valid function found in code")
@@ -37,6 +40,19 @@ func (p *FunctionParser) ExtractFunctionInfo(code string) (string, string, error
 	return functionName, returnType, nil
 }
 
+// ExtractFunctionPrototype returns the declaration of the function found by
+// ExtractFunctionInfo, e.g. "int add(int a, int b);"
+func (p *FunctionParser) ExtractFunctionPrototype(code string) (string, error) {
+	matches := functionPattern.FindStringSubmatch(code)
+	if len(matches) < 4 {
+		return "", fmt.Errorf("no valid function found in code")
+	}
+
+	returnType := strings.Join(strings.Fields(matches[1]), " ")
+	params := strings.Join(strings.Fields(matches[3]), " ")
+	return fmt.Sprintf("%s %s(%s);", returnType, matches[2], params), nil
+}
+
 // ExtractFunctionName extracts just the function name (backward compatibility)
 func (p *FunctionParser) ExtractFunctionName(code string) (string, error) {
 	name, _, err := p.ExtractFunctionInfo(code)
@@ -0,0 +1,105 @@
+package template
+
+import (
+	"fmt"
+	"strings"
+	"testing"
+
+	"code-runner/internal/types"
+
+	"github.com/google/uuid"
+)
+
+// benchmarkSolution builds a solution with helpers helper functions before the
+// function under test, so the function pattern scans the whole file
+func benchmarkSolution(helpers int) string {
+	var b strings.Builder
+	b.WriteString("#include <vector>\n#include <string>\nusing namespace std;\n\n")
+	for i := 0; i < helpers; i++ {
+		// Helpers are static, so they do not match the function pattern
+		fmt.Fprintf(&b, "static inline long helper%d(long x) {\n    // keep x in range\n    return (x * %d) %% 1000003;\n}\n\n", i, i+1)
+	}
+	b.WriteString("int solve(int* nums, int n) {\n    long total = 0;\n    for (int i = 0; i < n; i++) {\n        total += nums[i];\n    }\n    return (int)total;\n}\n")
+	return b.String()
+}
+
+// benchmarkArray returns an array literal with n elements, e.g. "[0,7,14]"
+func benchmarkArray(n int) string {
+	elements := make([]string, n)
+	for i := range elements {
+		elements[i] = fmt.Sprint(i * 7 % 100003)
+	}
+	return "[" + strings.Join(elements, ",") + "]"
+}
+
+// benchmarkTests returns count test cases with inputs like the ones challenges use:
+// scalars, several parameters, string arrays and number arrays of arraySize elements
+func benchmarkTests(count, arraySize int) []*types.TestCase {
+	array := benchmarkArray(arraySize)
+	tests := make([]*types.TestCase, count)
+	for i := range tests {
+		test := &types.TestCase{CodeVersionTestID: uuid.New(), ExpectedOutput: fmt.Sprint(i)}
+		switch i % 4 {
+		case 0:
+			test.Input = fmt.Sprint(i)
+		case 1:
+			test.Input = fmt.Sprintf("%d, %d, hello", i, i*2)
+		case 2:
+			test.Input = `["flower","flow","flight"]`
+			test.ExpectedOutput = "fl"
+		case 3:
+			test.Input = array + fmt.Sprintf(", %d", i)
+		}
+		tests[i] = test
+	}
+	return tests
+}
+
+func BenchmarkFunctionParser_ExtractFunctionInfo(b *testing.B) {
+	parser := NewFunctionParser()
+	for _, helpers := range []int{0, 200} {
+		code := benchmarkSolution(helpers)
+		b.Run(fmt.Sprintf("helpers=%d", helpers), func(b *testing.B) {
+			b.ReportAllocs()
+			b.SetBytes(int64(len(code)))
+			for i := 0; i < b.N; i++ {
+				if _, _, err := parser.ExtractFunctionInfo(code); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
+
+func BenchmarkInputParser_ParseComplexInput(b *testing.B) {
+	parser := NewInputParser()
+	inputs := []struct {
+		name  string
+		input string
+	}{
+		{"scalar", "42"},
+		{"params", "3, 4.5, hello, true"},
+		{"strings", `["flower","flow","flight"]`},
+		{"array=100000", benchmarkArray(100000) + ", 5"},
+	}
+	for _, tc := range inputs {
+		b.Run(tc.name, func(b *testing.B) {
+			b.ReportAllocs()
+			b.SetBytes(int64(len(tc.input)))
+			for i := 0; i < b.N; i++ {
+				parser.ParseComplexInput(tc.input, "solve", i)
+			}
+		})
+	}
+}
+
+func BenchmarkTestGenerator_GenerateTestCode(b *testing.B) {
+	generator := NewTestGenerator()
+	tests := benchmarkTests(500, 1000)
+	b.ReportAllocs()
+	for i := 0; i < b.N; i++ {
+		if _, count := generator.GenerateTestCode(tests, "solve", "int"); count != len(tests) {
+			b.Fatalf("Generated %d tests, want %d", count, len(tests))
+		}
+	}
+}
@@ -2,10 +2,40 @@ package template
 
 import (
 	"fmt"
+	"regexp"
+	"strings"
 
 	"code-runner/internal/types"
 )
 
+// splitUnsafePattern matches constructs a declarations header cannot reproduce from the
+// function prototype alone: user-defined types and aliases, macros, templates, named
+// namespaces around the solution and deduced (auto) return types, which cannot be called
+// through a bare prototype
+var splitUnsafePattern = regexp.MustCompile(`(?m)\b(?:struct|class|union|enum|typedef|template)\b|\bnamespace\s+\w+\s*\{|\busing\s+\w+\s*=|^\s*#\s*define\b|^\s*(?:const\s+)?\bauto\b\s*[&*]?\s*\w+\s*\(`)
+
+// declarationLinePattern matches the solution lines the header repeats so the prototype
+// compiles: #include directives, using-namespace directives and using-declarations
+var declarationLinePattern = regexp.MustCompile(`(?m)^[ \t]*(?:#[ \t]*include\b.*|using[ \t]+(?:namespace[ \t]+)?[\w:]+[ \t]*;)[ \t]*$`)
+
+// usingStatementPattern matches a file-scope using-directive or using-declaration, which
+// the header repeats
+var usingStatementPattern = regexp.MustCompile(`^using\s+(?:namespace\s+)?[\w:]+$`)
+
+// functionStatementPattern matches a file-scope function declaration (forward prototype)
+var functionStatementPattern = regexp.MustCompile(`^[^=(]*\w\s*\(.*\)\s*(?:const)?$`)
+
+// functionHeaderEndPattern matches the end of a function header before its body, so the
+// body's closing brace ends the statement
+var functionHeaderEndPattern = regexp.MustCompile(`\)\s*(?:const|noexcept|override)?\s*$`)
+
+// templatePrelude is what every translation unit holding solution code starts with, so the
+// solution compiles the same way in the single template and in solution.cpp: solutions may
+// rely on it (e.g. strlen without including <cstring>)
+const templatePrelude = `#include "doctest.h"
+#include <cstring>
+`
+
 // TemplateBuilder handles building the complete C++ template
 type TemplateBuilder struct{}
 
@@ -14,23 +44,139 @@ func NewTemplateBuilder() *TemplateBuilder {
 	return &TemplateBuilder{}
 }
 
-// BuildTemplate constructs the complete template by replacing sections
+// BuildTemplate constructs the complete template by replacing sections.
+// doctest's implementation and main() are not defined here: they come precompiled
+// in the coderunner-cpp image, and "doctest.h" must stay the first include so the
+// precompiled header is picked up.
 func (b *TemplateBuilder) BuildTemplate(solutionCode, testCode string) string {
 	template := `// Start Test
-#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
-#include "doctest.h"
-#include <cstring>
+%s
+// Solution - Start
+%s
+// Solution - End
+
+// Tests - Start
+%s
+// Tests - End
+`
+
+	return fmt.Sprintf(template, templatePrelude, solutionCode, testCode)
+}
 
+// BuildSolutionUnit constructs the solution translation unit of the split compilation:
+// the student's code behind the same prelude BuildTemplate gives it
+func (b *TemplateBuilder) BuildSolutionUnit(solutionCode string) string {
+	template := `%s
 // Solution - Start
 %s
 // Solution - End
+`
+
+	return fmt.Sprintf(template, templatePrelude, solutionCode)
+}
+
+// SupportsSplitCompilation reports whether the tests can be compiled apart from the
+// solution, seeing only the header built by BuildDeclarations. Custom validation code
+// may use anything the solution defines, so it always needs the single template.
+func (b *TemplateBuilder) SupportsSplitCompilation(solutionCode string, tests []*types.TestCase) bool {
+	return !b.HasCustomValidation(tests) && !splitUnsafePattern.MatchString(solutionCode) &&
+		!hasFileScopeVariables(solutionCode)
+}
+
+// hasFileScopeVariables reports whether the solution declares anything at file scope other
+// than functions and using statements (constants, globals, lambdas). The prototype may
+// depend on them (e.g. int f(int a[MAXN])) and the header does not repeat them.
+func hasFileScopeVariables(solutionCode string) bool {
+	var lines []string
+	for _, line := range strings.Split(solutionCode, "\n") {
+		if !strings.HasPrefix(strings.TrimSpace(line), "#") {
+			lines = append(lines, line)
+		}
+	}
+	code := strings.Join(lines, "\n")
+
+	depth := 0
+	var statement strings.Builder
+	for i := 0; i < len(code); i++ {
+		c := code[i]
+		switch {
+		case strings.HasPrefix(code[i:], "//"):
+			for i < len(code) && code[i] != '\n' {
+				i++
+			}
+			statement.WriteByte(' ')
+		case strings.HasPrefix(code[i:], "/*"):
+			end := strings.Index(code[i+2:], "*/")
+			if end < 0 {
+				return false
+			}
+			i += end + 3
+			statement.WriteByte(' ')
+		case c == '"' || (c == '\'' && (i == 0 || !isIdentifierByte(code[i-1]))):
+			// Skip the literal (a quote after a digit is a digit separator)
+			for i++; i < len(code) && code[i] != c; i++ {
+				if code[i] == '\\' {
+					i++
+				}
+			}
+			if depth == 0 {
+				statement.WriteByte('x')
+			}
+		case c == '{':
+			depth++
+		case c == '}':
+			depth--
+			if depth == 0 && functionHeaderEndPattern.MatchString(statement.String()) {
+				statement.Reset()
+			}
+		case c == ';' && depth == 0:
+			declaration := strings.Join(strings.Fields(statement.String()), " ")
+			statement.Reset()
+			if declaration != "" && !usingStatementPattern.MatchString(declaration) &&
+				!functionStatementPattern.MatchString(declaration) {
+				return true
+			}
+		case depth == 0:
+			statement.WriteByte(c)
+		}
+	}
+	return false
+}
+
+// isIdentifierByte reports whether c can be part of a C++ identifier or number
+func isIdentifierByte(c byte) bool {
+	return c == '_' || c >= '0' && c <= '9' || c >= 'a' && c <= 'z' || c >= 'A' && c <= 'Z'
+}
+
+// BuildDeclarations constructs the header the test translation unit compiles against:
+// the solution's includes and using statements followed by the prototype of the tested
+// function
+func (b *TemplateBuilder) BuildDeclarations(solutionCode, prototype string) string {
+	var header strings.Builder
+	header.WriteString("#pragma once\n")
+	for _, line := range declarationLinePattern.FindAllString(solutionCode, -1) {
+		header.WriteString(strings.TrimSpace(line))
+		header.WriteString("\n")
+	}
+	header.WriteString("\n")
+	header.WriteString(prototype)
+	header.WriteString("\n")
+	return header.String()
+}
+
+// BuildTestUnit constructs the test translation unit. It only depends on the tests and the
+// declarations header, so it compiles once per test set and the object is reused for
+// every solution with the same header.
+func (b *TemplateBuilder) BuildTestUnit(testCode string) string {
+	template := `// Start Test
+%s#include "solution.h"
 
 // Tests - Start
 %s
 // Tests - End
 `
 
-	return fmt.Sprintf(template, solutionCode, testCode)
+	return fmt.Sprintf(template, templatePrelude, testCode)
 }
 
 // HasCustomValidation checks if any test has custom validation
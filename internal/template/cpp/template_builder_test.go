@@ -0,0 +1,39 @@
+package template
+
+import (
+	"testing"
+
+	"code-runner/internal/types"
+)
+
+func TestTemplateBuilder_SupportsSplitCompilation(t *testing.T) {
+	builder := NewTemplateBuilder()
+	cases := []struct {
+		name string
+		code string
+		want bool
+	}{
+		{"plain function", "#include <vector>\nusing namespace std;\n\nint add(int a, int b) {\n    return a + b;\n}\n", true},
+		{"auto locals", "int sum(int* nums, int n) {\n    auto total = 0;\n    for (auto i = 0; i < n; i++) total += nums[i];\n    return total;\n}\n", true},
+		{"struct", "struct Point { int x; };\nint add(int a, int b) {\n    return a + b;\n}\n", false},
+		{"macro", "#define MAXN 100\nint add(int a, int b) {\n    return a + b;\n}\n", false},
+		{"auto return type", "auto add(int a, int b) {\n    return a + b;\n}\n", false},
+		{"const auto return type", "const auto add(int a, int b) {\n    return a + b;\n}\n", false},
+		{"using-declaration", "#include <string>\nusing std::string;\n\nint count(string s) {\n    return s.size();\n}\n", true},
+		{"forward declaration", "int helper(int x);\n\nint add(int a, int b) {\n    return helper(a) + b; // uses helper;\n}\n\nint helper(int x) { return x; }\n", true},
+		{"literals with semicolons", "int length() {\n    return sizeof(\"a;b\") + ';';\n}\n/* int hidden; */\n", true},
+		{"file-scope constant", "const int MAXN = 100;\n\nint first(int a[MAXN]) {\n    return a[0];\n}\n", false},
+		{"global array", "int memo[1'000];\n\nint fib(int n) {\n    return n < 2 ? n : fib(n - 1) + fib(n - 2);\n}\n", false},
+		{"brace-initialized global", "int primes[3]{2, 3, 5};\nint prime(int i) {\n    return primes[i];\n}\n", false},
+	}
+	for _, tc := range cases {
+		if got := builder.SupportsSplitCompilation(tc.code, nil); got != tc.want {
+			t.Errorf("%s: expected %v, got %v", tc.name, tc.want, got)
+		}
+	}
+
+	custom := []*types.TestCase{{CustomValidationCode: "CHECK(add(1, 2) == 3);"}}
+	if builder.SupportsSplitCompilation(cases[0].code, custom) {
+		t.Errorf("Custom validation must use the single template")
+	}
+}
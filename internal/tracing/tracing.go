@@ -0,0 +1,86 @@
+// Package tracing configura OpenTelemetry para el servicio: el exportador de trazas, la
+// propagación W3C (traceparent/baggage) y helpers para abrir y cerrar spans.
+//
+// Sin exportador (TRACING_EXPORTER=none) los spans no se registran, pero el contexto de
+// traza que llega por gRPC igual se propaga a los mensajes de Kafka.
+package tracing
+
+import (
+	"context"
+	"fmt"
+	"log"
+
+	"go.opentelemetry.io/otel"
+	"go.opentelemetry.io/otel/attribute"
+	"go.opentelemetry.io/otel/codes"
+	"go.opentelemetry.io/otel/exporters/otlp/otlptrace/otlptracehttp"
+	"go.opentelemetry.io/otel/propagation"
+	"go.opentelemetry.io/otel/sdk/resource"
+	sdktrace "go.opentelemetry.io/otel/sdk/trace"
+	"go.opentelemetry.io/otel/trace"
+)
+
+// tracerName identifica los spans del servicio (instrumentation scope)
+const tracerName = "code-runner"
+
+// Config es la configuración del exportador de trazas
+type Config struct {
+	Exporter     string  // none | otlp
+	OTLPEndpoint string  // host:puerto del collector (OTLP/HTTP)
+	OTLPInsecure bool    // Enviar sin TLS (collector local)
+	SampleRatio  float64 // Fracción de trazas raíz que se registran (las hijas siguen al padre)
+	ServiceName  string
+}
+
+// Init instala la propagación y, si hay exportador, el TracerProvider global. Retorna la
+// función que vacía los spans pendientes al apagar el servicio.
+func Init(ctx context.Context, config Config) (func(context.Context) error, error) {
+	otel.SetTextMapPropagator(propagation.NewCompositeTextMapPropagator(propagation.TraceContext{}, propagation.Baggage{}))
+
+	switch config.Exporter {
+	case "", "none":
+		log.Printf("ℹ️  Tracing disabled (trace context is still propagated)")
+		return func(context.Context) error { return nil }, nil
+	case "otlp":
+	default:
+		return nil, fmt.Errorf("unknown tracing exporter %q (none or otlp)", config.Exporter)
+	}
+
+	options := []otlptracehttp.Option{otlptracehttp.WithEndpoint(config.OTLPEndpoint)}
+	if config.OTLPInsecure {
+		options = append(options, otlptracehttp.WithInsecure())
+	}
+	exporter, err := otlptracehttp.New(ctx, options...)
+	if err != nil {
+		return nil, fmt.Errorf("failed to create OTLP exporter: %w", err)
+	}
+
+	res, err := resource.Merge(resource.Default(), resource.NewSchemaless(attribute.String("service.name", config.ServiceName)))
+	if err != nil {
+		return nil, fmt.Errorf("failed to build tracing resource: %w", err)
+	}
+
+	provider := sdktrace.NewTracerProvider(
+		sdktrace.WithBatcher(exporter),
+		sdktrace.WithResource(res),
+		sdktrace.WithSampler(sdktrace.ParentBased(sdktrace.TraceIDRatioBased(config.SampleRatio))),
+	)
+	otel.SetTracerProvider(provider)
+
+	log.Printf("🔭 Tracing enabled: OTLP/HTTP to %s (sample ratio %.2f)", config.OTLPEndpoint, config.SampleRatio)
+	return provider.Shutdown, nil
+}
+
+// Start abre un span hijo del que lleve ctx
+func Start(ctx context.Context, name string, opts ...trace.SpanStartOption) (context.Context, trace.Span) {
+	return otel.Tracer(tracerName).Start(ctx, name, opts...)
+}
+
+// End cierra el span, marcándolo como fallido si err no es nil
+func End(span trace.Span, err error) {
+	if err != nil {
+		span.RecordError(err)
+		span.SetStatus(codes.Error, err.Error())
+	}
+	span.End()
+}
@@ -4,6 +4,8 @@ import (
 	"time"
 
 	"github.com/google/uuid"
+
+	"code-runner/internal/docker"
 )
 
 // ExecutionRequest representa la solicitud de ejecución de código
@@ -16,6 +18,13 @@ type ExecutionRequest struct {
 	Language      string           `json:"language"`
 	Config        *ExecutionConfig `json:"config,omitempty"`
 	TestCases     []*TestCase      `json:"test_cases"`
+	FailFast      bool             `json:"fail_fast,omitempty"` // Detener la corrida en el primer test fallido
+
+	// TestTimeLimitMS es el límite de tiempo real por test (0 = el del servicio)
+	TestTimeLimitMS int64 `json:"test_time_limit_ms,omitempty"`
+
+	// Compiler es el perfil de compilación validado (con los valores por defecto completos)
+	Compiler docker.CompilerProfile `json:"compiler"`
 }
 
 // TestCase representa un caso de prueba
@@ -1,7 +1,6 @@
 // Start Test 
-#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
-// Solution - Start
 #include "doctest.h"
+// Solution - Start
 #include <iostream>
 namespace std;
 